@@ -0,0 +1,128 @@
+/**
+ * @brief ThreadPool 微基准：比较 parallelFor、依赖任务的扇出/等待与串行执行的耗时
+ *
+ * 用法：thread_pool_benchmark [重复次数]
+ * 每项测试先预热一次，再取多次重复的平均值（微秒）；加速比 = 串行耗时 / 并行耗时。
+ */
+#include "../src/engine/core/thread_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+namespace {
+    using engine::core::JobCounter;
+    using engine::core::ThreadPool;
+
+    volatile float sink = 0.0f;     // 防止编译器优化掉计算结果
+
+    /// @brief 每个元素的工作量（几次浮点运算，量级接近一次积分或一次包围盒检测）
+    inline float work(float value) {
+        return std::sqrt(value * value + 1.0f) * 0.5f + std::sin(value) * 0.25f;
+    }
+
+    template<typename Func>
+    double measure(int repeats, Func&& func) {
+        func();     // 预热
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeats; ++i) {
+            func();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / repeats;
+    }
+
+    void runSerial(std::vector<float>& data, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            data[i] = work(data[i]);
+        }
+    }
+
+    /// @brief parallelFor：不同元素数与每块最少元素数
+    void benchParallelFor(ThreadPool& pool, int repeats) {
+        for (size_t count : {1024u, 16384u, 262144u}) {
+            std::vector<float> data(count, 1.0f);
+            const double serial = measure(repeats, [&] { runSerial(data, 0, count); });
+            for (size_t min_batch : {32u, 64u, 256u, 1024u}) {
+                size_t chunks = 0;
+                const double parallel = measure(repeats, [&] {
+                    chunks = pool.parallelFor(count, min_batch, [&](size_t begin, size_t end, size_t) { runSerial(data, begin, end); });
+                });
+                std::printf("  parallelFor  count=%-7zu min_batch=%-5zu chunks=%-3zu serial=%9.2fus parallel=%9.2fus speedup=%5.2f\n",
+                            count, min_batch, chunks, serial, parallel, serial / parallel);
+            }
+            sink = sink + data[count / 2];
+        }
+    }
+
+    /// @brief 依赖任务：第一阶段扇出 N 个任务各自计算部分和，等待后第二阶段的任务读取全部部分和
+    void benchDependentJobs(ThreadPool& pool, int repeats) {
+        constexpr size_t STAGE_JOBS = 64;
+        for (size_t job_size : {16u, 256u, 4096u}) {
+            std::vector<float> data(STAGE_JOBS * job_size, 1.0f);
+            std::vector<float> partial(STAGE_JOBS, 0.0f);
+            std::vector<float> output(STAGE_JOBS, 0.0f);
+
+            struct Stage {
+                std::vector<float>* data;
+                std::vector<float>* partial;
+                std::vector<float>* output;
+                size_t job_size;
+            } stage{&data, &partial, &output, job_size};
+            const ThreadPool::JobFunction produce = [](void* user, size_t index) {
+                auto& s = *static_cast<Stage*>(user);
+                float sum = 0.0f;
+                for (size_t i = index * s.job_size; i < (index + 1) * s.job_size; ++i) {
+                    sum += work((*s.data)[i]);
+                }
+                (*s.partial)[index] = sum;
+            };
+            const ThreadPool::JobFunction consume = [](void* user, size_t index) {
+                auto& s = *static_cast<Stage*>(user);
+                float sum = 0.0f;
+                for (auto value : *s.partial) {
+                    sum += value;
+                }
+                (*s.output)[index] = sum / static_cast<float>(index + 1);
+            };
+
+            const double serial = measure(repeats, [&] {
+                for (size_t i = 0; i < STAGE_JOBS; ++i) produce(&stage, i);
+                for (size_t i = 0; i < STAGE_JOBS; ++i) consume(&stage, i);
+            });
+            const double parallel = measure(repeats, [&] {
+                JobCounter produced;
+                for (size_t i = 0; i < STAGE_JOBS; ++i) pool.run(produced, produce, &stage, i);
+                pool.wait(produced);    // 第二阶段依赖第一阶段的全部结果
+                JobCounter consumed;
+                for (size_t i = 0; i < STAGE_JOBS; ++i) pool.run(consumed, consume, &stage, i);
+                pool.wait(consumed);
+            });
+            std::printf("  dependent    jobs=2x%-3zu job_size=%-5zu          serial=%9.2fus parallel=%9.2fus speedup=%5.2f\n",
+                        STAGE_JOBS, job_size, serial, parallel, serial / parallel);
+            sink = sink + output[0];
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int repeats = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200;
+    const unsigned hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // 工作线程数（不含主线程）：1、3 与硬件线程数 - 1
+    std::set<size_t> worker_counts = {1, 3};
+    if (hardware_threads > 1) worker_counts.insert(hardware_threads - 1);
+
+    std::printf("hardware threads: %u, repeats: %d\n", hardware_threads, repeats);
+    for (auto workers : worker_counts) {
+        ThreadPool pool(workers);
+        std::printf("workers=%zu (threads=%zu)\n", workers, pool.getThreadCount());
+        benchParallelFor(pool, repeats);
+        benchDependentJobs(pool, repeats);
+    }
+    return 0;
+}
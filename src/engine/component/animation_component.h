@@ -28,6 +28,8 @@ private:
     bool is_one_shot_removeal_ = false;   // 是否在播放完一次动画后移除GameObject
 
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::ANIMATION;
+
     AnimationComponent() = default;
     ~AnimationComponent() override;
 
@@ -48,6 +50,7 @@ public:
     bool isOneShotRemoveal() const { return is_one_shot_removeal_; }
     void setOneShotRemoveal(bool value) { is_one_shot_removeal_ = value; }
 
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::ANIMATION; }   // 在游戏逻辑之后推进动画
 
 protected:
     void init() override;
@@ -25,6 +25,8 @@ private:
     std::unordered_map<std::string, std::string> sound_id_to_path_; // 音效ID到路径的映射
 
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::AUDIO;
+
     AudioComponent(engine::audio::AudioPlayer* audio_player, engine::render::Camera* camera);
     ~AudioComponent() override = default;
 
@@ -44,6 +46,8 @@ public:
 
     void addSound(const std::string& sound_id, const std::string& path);
 
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::NONE; }   // 无需每步更新
+
 private:
     void init() override;
     void update(float, engine::core::Context&) override {}
@@ -2,6 +2,7 @@
 
 #include "component.h"
 #include "../physics/collider.h"
+#include "../physics/collision_layer.h"
 #include "../utils/math.h"
 #include "../utils/alignment.h"
 #include <memory>
@@ -22,7 +23,12 @@ private:
     bool is_trigger_ = false;   // 是否是触发器(仅检测碰撞，不产生物理响应)
     bool is_active_ = true;   // 是否激活
 
+    engine::physics::CollisionMask collision_layer_ = engine::physics::CollisionLayer::DEFAULT;  // 所属的碰撞层
+    engine::physics::CollisionMask collision_mask_ = engine::physics::CollisionLayer::ALL;       // 与哪些层检测碰撞
+
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::COLLIDER;
+
     explicit ColliderComponent(
         std::unique_ptr<engine::physics::Collider> collider,
         engine::utils::Alignment alignment = engine::utils::Alignment::NONE,
@@ -44,12 +50,18 @@ public:
     engine::utils::Rect getWorldAABB() const;           // 获取世界坐标下的最小包围盒
     bool isTrigger() const { return is_trigger_; }
     bool isActive() const { return is_active_; }
+    engine::physics::CollisionMask getCollisionLayer() const { return collision_layer_; }
+    engine::physics::CollisionMask getCollisionMask() const { return collision_mask_; }
 
     // setters
     void setAlignment(engine::utils::Alignment alignment); // 设置对齐方式，重新计算偏移量
     void setOffset(const glm::vec2& offset) { offset_ = offset; } // 设置偏移量
     void setTrigger(bool is_trigger) { is_trigger_ = is_trigger; }
     void setActive(bool is_active) { is_active_ = is_active; }
+    void setCollisionLayer(engine::physics::CollisionMask layer) { collision_layer_ = layer; }
+    void setCollisionMask(engine::physics::CollisionMask mask) { collision_mask_ = mask; }
+
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::NONE; }   // 无需每步更新
 
 private:
     void init() override;
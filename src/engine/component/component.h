@@ -1,8 +1,11 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 
 namespace engine::object
 {
     class GameObject;
+    class UpdateScheduler;
 }
 
 namespace engine::core
@@ -12,9 +15,68 @@ namespace engine::core
 
 namespace engine::component
 {
+    /// @brief 组件类型编号（每个组件类型一个，编译期常量），用作 GameObject 组件槽位的下标
+    using ComponentTypeId = std::uint32_t;
+    /// @brief 组件类型数量上限（GameObject 以一个 32 位掩码记录拥有的组件）
+    inline constexpr ComponentTypeId MAX_COMPONENT_TYPES = 32;
+
+    /// @brief 引擎内置组件的类型编号（集中列出，便于检查是否重复）
+    namespace component_type_ids
+    {
+        inline constexpr ComponentTypeId TRANSFORM  = 0;
+        inline constexpr ComponentTypeId SPRITE     = 1;
+        inline constexpr ComponentTypeId ANIMATION  = 2;
+        inline constexpr ComponentTypeId PHYSICS    = 3;
+        inline constexpr ComponentTypeId COLLIDER   = 4;
+        inline constexpr ComponentTypeId TILE_LAYER = 5;
+        inline constexpr ComponentTypeId PARALLAX   = 6;
+        inline constexpr ComponentTypeId AUDIO      = 7;
+        inline constexpr ComponentTypeId HEALTH     = 8;
+    } // namespace component_type_ids
+    /// @brief 游戏层组件的编号从这里开始依次分配
+    inline constexpr ComponentTypeId FIRST_GAME_COMPONENT_TYPE_ID = 9;
+
+    namespace detail
+    {
+        template <typename T>
+        consteval ComponentTypeId checkedComponentTypeId()
+        {
+            static_assert(requires { T::COMPONENT_TYPE_ID; }, "Component type must declare static constexpr COMPONENT_TYPE_ID");
+            static_assert(T::COMPONENT_TYPE_ID < MAX_COMPONENT_TYPES, "COMPONENT_TYPE_ID out of range, increase MAX_COMPONENT_TYPES");
+            return T::COMPONENT_TYPE_ID;
+        }
+    } // namespace detail
+
+    /**
+     * @brief 组件类型 T 的编号
+     *
+     * 取自组件类中声明的 COMPONENT_TYPE_ID，超出 MAX_COMPONENT_TYPES 时编译失败。
+     * 派生自其他具体组件的类需声明自己的编号，否则会与基类共用槽位。
+     */
+    template <typename T>
+    inline constexpr ComponentTypeId component_type_id = detail::checkedComponentTypeId<T>();
+
+    /**
+     * @brief 组件的更新阶段，场景每步按以下顺序依次更新各阶段的组件（同一阶段内按加入场景的顺序）
+     *
+     * 物理引擎在 PRE_PHYSICS 之后、PHYSICS 之前模拟一步。
+     */
+    enum class UpdatePhase : std::uint8_t {
+        INPUT,          // 读取输入状态
+        AI,             // 决策（在物理之前设置速度、受力）
+        PRE_PHYSICS,    // 物理模拟之前的其他逻辑
+        PHYSICS,        // 紧接物理模拟之后（读取本步的模拟结果）
+        POST_PHYSICS,   // 物理之后的游戏逻辑（默认）
+        ANIMATION,      // 动画
+        RENDER_PREP,    // 渲染前的准备
+        NONE,           // 不需要每步更新
+    };
+    inline constexpr size_t UPDATE_PHASE_COUNT = static_cast<size_t>(UpdatePhase::NONE);
+
     class Component
     {
         friend class engine::object::GameObject; // 需要调用 Component 的 init 方法
+        friend class engine::object::UpdateScheduler; // 按阶段调用 update，并记录组件在阶段列表中的位置
 
     protected:
         engine::object::GameObject *owner_ = nullptr; // 指向拥有此组件的GameObject
@@ -31,6 +93,9 @@ namespace engine::component
         void setOwner(engine::object::GameObject *owner) { owner_ = owner; }
         engine::object::GameObject *getOwner() const { return owner_; }
 
+        /// @brief 组件的更新阶段（须保持不变）；update 为空的组件应返回 NONE，不进入任何更新列表
+        virtual UpdatePhase getUpdatePhase() const { return UpdatePhase::POST_PHYSICS; }
+
 
     protected:
         virtual void init() {} // 保留两段初始化的机制, GameObject 添加组件时自动调用, 不需要外部调用
@@ -38,5 +103,8 @@ namespace engine::component
         virtual void update(float, engine::core::Context&) {}
         virtual void render(engine::core::Context&) {}
         virtual void clean() {}
+
+    private:
+        std::uint32_t update_slot_ = 0xFFFFFFFFu;   // 在 UpdateScheduler 阶段列表中的位置（未登记时为无效值）
     };
 } // namespace engine::component
\ No newline at end of file
@@ -14,6 +14,8 @@ private:
     float invincible_timer_ = 0.0f; //无敌状态计时器（秒）
 
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::HEALTH;
+
     explicit HealthComponent(int max_health = 1, float invincible_durantion = 2.0f);
     ~HealthComponent() override = default;
 
@@ -36,6 +38,8 @@ public:
     void setInvincible(float durantion);        // 进入无敌状态，持续一定时间
     void setInvincibleDuration(float durantion) { invincible_durantion_ = durantion; }    // 设置无敌状态持续时间
 
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::POST_PHYSICS; }   // 无敌计时
+
 protected:
     void update(float,engine::core::Context&) override;
 };
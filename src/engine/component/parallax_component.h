@@ -20,6 +20,8 @@ private:
     bool is_hidden_ = false;               // 是否隐藏（不渲染）
 
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::PARALLAX;
+
     ParallaxComponent(const std::string& texture_id, const glm::vec2& scroll_factor, const glm::bvec2& repeat);
 
     // setters
@@ -34,6 +36,8 @@ public:
     const glm::bvec2& getRepeat() const { return repeat_; }
     bool isHidden() const { return is_hidden_; }
 
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::NONE; }   // 无需每步更新
+
 protected:
     void update(float, engine::core::Context&) override {}
     void init() override;
@@ -6,13 +6,17 @@
 
 namespace engine::component{
     PhysicsComponent::PhysicsComponent(engine::physics::PhysicsEngine *physics_engine, bool use_gravity, float mass)
-    : physics_engine_(physics_engine), mass_(mass), use_gravity_(use_gravity)
+    : physics_engine_(physics_engine)
     {
         if (!physics_engine_)
         {
             spdlog::error("PhysicsComponent: PhysicsEngine is null");
+            return;
         }
-        spdlog::trace("PhysicsComponent: created, use_gravity: {}, mass: {}", use_gravity_, mass_);
+        // 刚体数据存放在物理引擎中，组件只保存句柄
+        bodies_ = &physics_engine_->getBodies();
+        handle_ = physics_engine_->createBody(this, use_gravity, mass);
+        spdlog::trace("PhysicsComponent: created, use_gravity: {}, mass: {}", use_gravity, getMass());
     }
 
     void PhysicsComponent::init()
@@ -38,9 +42,17 @@ namespace engine::component{
         spdlog::trace("PhysicsComponent: inited");
     }
 
+    void PhysicsComponent::setBodyType(engine::physics::BodyType type)
+    {
+        if (!physics_engine_) return;
+        physics_engine_->setBodyType(handle_, type);
+    }
+
     void PhysicsComponent::clean()
     {
+        if (!physics_engine_) return;
         physics_engine_->unregisterComponent(this);
+        handle_ = engine::physics::INVALID_BODY_HANDLE;
         spdlog::trace("PhysicsComponent: cleaned");
     }
 
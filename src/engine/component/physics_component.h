@@ -1,5 +1,6 @@
 #pragma once
 #include "component.h"
+#include "../physics/body_storage.h"
 #include <glm/vec2.hpp>
 
 namespace engine::physics {
@@ -9,30 +10,25 @@ namespace engine::physics {
 namespace engine::component {
 class TransformComponent;
 
+/**
+ * @brief 物理组件，本身只是指向 PhysicsEngine 中刚体数据（BodyStorage）的句柄
+ *
+ * 速度、受力、质量、标志位等数据都存放在物理引擎的结构数组中，这里的接口只是读写对应元素。
+ * 没有有效刚体时（物理引擎为空、刚体创建失败或已被清理），读取返回默认值，修改不产生效果。
+ */
 class PhysicsComponent final : public Component{
     friend class engine::object::GameObject;
-public:
-    glm::vec2 velocity_ = {0.0f, 0.0f};         // 物体的速度，设置为公共成员变量方便 PhysicsEngine 调用
 
 private:
     engine::physics::PhysicsEngine* physics_engine_ = nullptr;
+    engine::physics::BodyStorage* bodies_ = nullptr;    // 物理引擎的刚体存储，非拥有指针
+    engine::physics::BodyHandle handle_ = engine::physics::INVALID_BODY_HANDLE;    // 刚体句柄
     TransformComponent* transform_ = nullptr;
-
-    glm::vec2 force_ = {0.0f, 0.0f};             // 当前帧物体的受力
-    float mass_ = 1.0f;                           // 物体的质量
-    bool use_gravity_ = true;                        // 物体是否受重力影响
-    bool enable_ = true;                          // 物体是否启用物理引擎
-
-
-    // 碰撞状态标志
-    bool collided_below_ = false;
-    bool collided_above_ = false;
-    bool collided_left_ = false;
-    bool collided_right_ = false;
-    bool collided_ladder_ = false;
-    bool is_on_top_ladder_ = false;
+    glm::vec2 detached_velocity_ = {0.0f, 0.0f};    // 没有有效刚体时 velocity() 返回的占位值
 
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::PHYSICS;
+
     PhysicsComponent(engine::physics::PhysicsEngine* physics_engine, bool use_gravity = true, float mass = 1.0f);
     ~PhysicsComponent() override = default;
 
@@ -41,49 +37,71 @@ public:
     PhysicsComponent(PhysicsComponent&&) = delete;
     PhysicsComponent& operator=(PhysicsComponent&&) = delete;
 
-    void addForce(const glm::vec2& force) { if (enable_) force_ += force; }
-    void clearForce() { force_ = {0.0f, 0.0f}; }
-    const glm::vec2& getForce() const { return force_; }
-    float getMass() const { return mass_; }
-    bool isEnable() const { return enable_; }
-    bool isUseGravity() const { return use_gravity_; }
-
-    void setEnable(bool enable) { enable_ = enable; }
-    void setMass(float mass) { mass_ = (mass >= 0.0f) ? mass : 1.0f; }
-    void setUseGravity(bool use_gravity) { use_gravity_ = use_gravity; }
-    void setVelocity(const glm::vec2& velocity) { velocity_ = velocity; }
-    const glm::vec2& getVelocity() const { return velocity_; }
+    /// @brief 是否关联着有效的刚体（句柄的代数与刚体存储一致）
+    bool hasBody() const { return bodies_ && bodies_->isValid(handle_); }
+
+    glm::vec2& velocity() { return hasBody() ? bodies_->velocity_[index()] : detached_velocity_; }     // 物体的速度（可直接修改分量）
+    const glm::vec2& getVelocity() const { return hasBody() ? bodies_->velocity_[index()] : detached_velocity_; }
+    void setVelocity(const glm::vec2& velocity) { if (hasBody()) bodies_->velocity_[index()] = velocity; }
+
+    void addForce(const glm::vec2& force) { if (isEnable()) bodies_->force_[index()] += force; }
+    void clearForce() { if (hasBody()) bodies_->force_[index()] = {0.0f, 0.0f}; }
+    glm::vec2 getForce() const { return hasBody() ? bodies_->force_[index()] : glm::vec2(0.0f, 0.0f); }
+    float getMass() const { return hasBody() ? bodies_->mass_[index()] : 0.0f; }
+    bool isEnable() const { return hasFlag(engine::physics::BodyFlags::ENABLED); }
+    bool isUseGravity() const { return hasFlag(engine::physics::BodyFlags::USE_GRAVITY); }
+
+    void setEnable(bool enable) { setFlag(engine::physics::BodyFlags::ENABLED, enable); }
+    void setMass(float mass) { if (hasBody()) bodies_->setMass(index(), mass); }
+    void setUseGravity(bool use_gravity) { setFlag(engine::physics::BodyFlags::USE_GRAVITY, use_gravity); }
+    /// @brief 设置为高速物体：与瓦片层碰撞时检查移动路径上经过的所有瓦片，防止穿过薄墙（开销与经过的瓦片数成正比）
+    void setBullet(bool bullet) { setFlag(engine::physics::BodyFlags::BULLET, bullet); }
+    bool isBullet() const { return hasFlag(engine::physics::BodyFlags::BULLET); }
     TransformComponent* getTransform() const { return transform_; }
+    engine::physics::BodyHandle getBodyHandle() const { return handle_; }
+
+    /// @brief 设置刚体类型（静态刚体不移动，运动学刚体只按速度移动，动态刚体完整模拟）
+    void setBodyType(engine::physics::BodyType type);
+    engine::physics::BodyType getBodyType() const { return hasBody() ? bodies_->type_[index()] : engine::physics::BodyType::DYNAMIC; }
+    /// @brief 是否在休眠（修改速度、施加力或位置被改变时会自动唤醒）
+    bool isSleeping() const { return hasFlag(engine::physics::BodyFlags::SLEEPING); }
+    void wakeUp() { if (hasBody()) bodies_->wake(index()); }
+    /// @brief 设置为始终模拟：不受区块模拟级别与离开世界策略的影响（如玩家、相机跟随的目标）
+    void setAlwaysActive(bool always_active) { if (hasBody()) bodies_->always_active_[index()] = always_active ? 1 : 0; }
+    bool isAlwaysActive() const { return hasBody() && bodies_->always_active_[index()] != 0; }
+    /// @brief 本步是否因所在区块远离相机而未被模拟
+    bool isDormant() const { return hasFlag(engine::physics::BodyFlags::DORMANT); }
+    /// @brief 本步的时间倍率（降频模拟时为间隔步数，否则为 1），所属对象的逻辑应以相同的倍率更新
+    float getStepScale() const { return hasBody() ? bodies_->step_scale_[index()] : 1.0f; }
 
 
     // ------- 碰撞状态访问与修改（供 physicsEngine 使用）------------
-    void resetCollisionFlags(){
-        collided_below_ = false;
-        collided_above_ = false;
-        collided_left_ = false;
-        collided_right_ = false;
-        collided_ladder_ = false;
-        is_on_top_ladder_ = false;
-    }
-
-    void setCollidedBelow(bool collided) { collided_below_ = collided; }
-    void setCollidedAbove(bool collided) { collided_above_ = collided; }
-    void setCollidedLeft(bool collided) { collided_left_ = collided; }
-    void setCollidedRight(bool collided) { collided_right_ = collided; }
-    void setCollidedLadder(bool collided) { collided_ladder_ = collided; }
-    void setOnTopLadder(bool on_top_ladder) { is_on_top_ladder_ = on_top_ladder; }
-
-    bool hasCollidedBelow() const { return collided_below_; }
-    bool hasCollidedAbove() const { return collided_above_; }
-    bool hasCollidedLeft() const { return collided_left_; }
-    bool hasCollidedRight() const { return collided_right_; }
-    bool hasCollidedLadder() const { return collided_ladder_; }
-    bool isOnTopLadder() const { return is_on_top_ladder_; }
+    void resetCollisionFlags() { setFlag(engine::physics::BodyFlags::COLLISION_STATE, false); }
+
+    void setCollidedBelow(bool collided) { setFlag(engine::physics::BodyFlags::COLLIDED_BELOW, collided); }
+    void setCollidedAbove(bool collided) { setFlag(engine::physics::BodyFlags::COLLIDED_ABOVE, collided); }
+    void setCollidedLeft(bool collided) { setFlag(engine::physics::BodyFlags::COLLIDED_LEFT, collided); }
+    void setCollidedRight(bool collided) { setFlag(engine::physics::BodyFlags::COLLIDED_RIGHT, collided); }
+    void setCollidedLadder(bool collided) { setFlag(engine::physics::BodyFlags::COLLIDED_LADDER, collided); }
+    void setOnTopLadder(bool on_top_ladder) { setFlag(engine::physics::BodyFlags::ON_TOP_LADDER, on_top_ladder); }
+
+    bool hasCollidedBelow() const { return hasFlag(engine::physics::BodyFlags::COLLIDED_BELOW); }
+    bool hasCollidedAbove() const { return hasFlag(engine::physics::BodyFlags::COLLIDED_ABOVE); }
+    bool hasCollidedLeft() const { return hasFlag(engine::physics::BodyFlags::COLLIDED_LEFT); }
+    bool hasCollidedRight() const { return hasFlag(engine::physics::BodyFlags::COLLIDED_RIGHT); }
+    bool hasCollidedLadder() const { return hasFlag(engine::physics::BodyFlags::COLLIDED_LADDER); }
+    bool isOnTopLadder() const { return hasFlag(engine::physics::BodyFlags::ON_TOP_LADDER); }
+
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::NONE; }   // 无需每步更新
 
 private:
     void init() override;
     void update(float, engine::core::Context&) override {}
     void clean() override;
+
+    size_t index() const { return bodies_->indexOf(handle_); }
+    bool hasFlag(std::uint16_t flag) const { return hasBody() && bodies_->hasFlag(index(), flag); }
+    void setFlag(std::uint16_t flag, bool value) { if (hasBody()) bodies_->setFlag(index(), flag, value); }
 };
 
 }   // namespace engine::component
\ No newline at end of file
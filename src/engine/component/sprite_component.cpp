@@ -3,6 +3,7 @@
 #include "../resource/resource_manager.h"
 #include "../object/game_object.h"
 #include "../core/context.h"
+#include "../core/time.h"
 #include "../render/renderer.h"
 #include <spdlog/spdlog.h>
 
@@ -107,7 +108,7 @@ void SpriteComponent::render(engine::core::Context &context)
         return;
     }
 
-    const glm::vec2& pos = transform_->getPosition() + offset_;
+    const glm::vec2& pos = transform_->getRenderPosition(context.getTime().getInterpolationAlpha()) + offset_;
     const glm::vec2& scale = transform_->getScale();
     float rotation_degress = transform_->getRotation();
 
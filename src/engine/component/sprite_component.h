@@ -32,6 +32,8 @@ namespace engine::component {
         bool is_hidden_ = false;
 
     public:
+        static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::SPRITE;
+
         SpriteComponent(
             const std::string& texture_id,
             engine::resource::ResourceManager& resource_manager,
@@ -70,6 +72,8 @@ namespace engine::component {
         void setFlipped(bool is_flipped) { sprite_.setFlipped(is_flipped); }
         void setHidden(bool is_hidden) { is_hidden_ = is_hidden; }
 
+        UpdatePhase getUpdatePhase() const override { return UpdatePhase::NONE; }   // 无需每步更新
+
     private:
         void updateSpriteSize();
 
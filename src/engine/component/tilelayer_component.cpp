@@ -16,6 +16,7 @@ namespace engine::component {
             tiles_.clear();
             map_size_ = {0, 0};
         }
+        collision_view_.build(tile_size_, map_size_, tiles_);
         spdlog::trace("TileLayerComponent created");
     }
 
@@ -39,8 +40,7 @@ namespace engine::component {
 
     TileType TileLayerComponent::getTileTypeAt(glm::ivec2 pos) const
     {
-        const TileInfo* info = getTileInfoAt(pos);
-        return info ? info->type : TileType::EMPTY;
+        return collision_view_.typeAt(pos.x, pos.y);
     }
 
     TileType TileLayerComponent::getTileTypeAtWorldPos(const glm::vec2 &world_pos) const
@@ -1,6 +1,7 @@
 #pragma once
 #include "../render/sprite.h"
 #include "component.h"
+#include "../physics/tile_collision_view.h"
 #include <vector>
 #include <glm/vec2.hpp>
 
@@ -51,16 +52,19 @@ private:
     glm::ivec2 map_size_;       // 地图尺寸（瓦片数）
     std::vector<TileInfo> tiles_;   // 所有瓦片信息（按照 行主序 存储，index = y * map_width + x）
     glm::vec2 offset_ = {0.0f, 0.0f};  // 瓦片层在世界中的偏移量
+    engine::physics::TileCollisionView collision_view_;     // 紧凑碰撞视图（构造时生成），供物理引擎查询
 
     bool is_hidden_ = false;  // 是否隐藏瓦片层
     engine::physics::PhysicsEngine* physics_engine_ = nullptr;  // 物理引擎指针, clean() 函数中可能需要反注册
 
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::TILE_LAYER;
+
     TileLayerComponent() = default;
     TileLayerComponent(glm::ivec2 tile_size, glm::ivec2 map_size, std::vector<TileInfo>&& tiles);
 
     const TileInfo* getTileInfoAt(glm::ivec2 pos) const;
-    TileType getTileTypeAt(glm::ivec2 pos) const;
+    TileType getTileTypeAt(glm::ivec2 pos) const;       ///< @brief 越界时返回 EMPTY（不输出日志）
     TileType getTileTypeAtWorldPos(const glm::vec2& world_pos) const;
 
     // getters
@@ -68,6 +72,7 @@ public:
     const glm::ivec2 getMapSize() const { return map_size_; }
     const glm::vec2 getWorldSize() const { return glm::vec2(map_size_.x * tile_size_.x, map_size_.y * tile_size_.y); }
     const std::vector<TileInfo>& getTiles() const { return tiles_; }
+    const engine::physics::TileCollisionView& getCollisionView() const { return collision_view_; }
     const glm::vec2& getOffset() const { return offset_; }
     bool isHidden() const { return is_hidden_; }
 
@@ -76,6 +81,8 @@ public:
     void setHidden(bool hidden) { is_hidden_ = hidden; }
     void setPhysicsEngine(engine::physics::PhysicsEngine* physics_engine) { physics_engine_ = physics_engine; }
 
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::NONE; }   // 无需每步更新
+
 protected:
     void init() override;
     void update(float,engine::core::Context&) override {}
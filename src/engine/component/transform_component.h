@@ -8,12 +8,15 @@ class TransformComponent final : public engine::component::Component {
     friend class engine::object::GameObject;
 
 public:
+    static constexpr ComponentTypeId COMPONENT_TYPE_ID = component_type_ids::TRANSFORM;
+
     glm::vec2 position_ = {0.0f, 0.0f};
+    glm::vec2 previous_position_ = {0.0f, 0.0f};    // 上一个模拟步开始时的位置，用于渲染插值
     glm::vec2 scale_ = {1.0f, 1.0f};
     float rotation_ = 0.0f;
 
     TransformComponent(glm::vec2 position = {0.0f, 0.0f}, glm::vec2 scale = {1.0f, 1.0f}, float rotation = 0.0f)
-        : position_(position), scale_(scale), rotation_(rotation) {}
+        : position_(position), previous_position_(position), scale_(scale), rotation_(rotation) {}
 
     TransformComponent(const TransformComponent&) = delete;
     TransformComponent& operator=(const TransformComponent&) = delete;
@@ -21,13 +24,21 @@ public:
     TransformComponent& operator=(TransformComponent&&) = delete;
 
     void translate(const glm::vec2& offset) { position_ += offset;}         // 平移
-    void setPosition(const glm::vec2& position) { position_ = position;}
+    void setPosition(const glm::vec2& position) { position_ = position;}   // 本步内的移动，渲染时从上一步的位置插值过来
+    /// @brief 瞬移（出生点、传送等非连续的移动）：同时设置上一步的位置，渲染时不会插值出一段划过的轨迹
+    void teleport(const glm::vec2& position) { position_ = position; previous_position_ = position; }
     void setScale(const glm::vec2& scale);
     void setRotation(float rotation) { rotation_ = rotation;}
     const glm::vec2&  getPosition() const { return position_;}
     const glm::vec2&  getScale() const { return scale_;}
     float getRotation() const { return rotation_;}
 
+    void storePreviousPosition() { previous_position_ = position_; }     // 每个模拟步开始时由场景调用
+    /// @brief 渲染位置：在上一步与当前步的位置之间插值（alpha 为 1 时即当前位置）
+    glm::vec2 getRenderPosition(float alpha) const { return previous_position_ + (position_ - previous_position_) * alpha; }
+
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::NONE; }   // 无需每步更新
+
 private:
     void update(float, engine::core::Context&) override {}
 };
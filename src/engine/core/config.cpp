@@ -81,6 +81,45 @@ void Config::formJson(const nlohmann::json &json)
             spdlog::warn("target_fps is less than 0, set to 0");
             target_fps_ = 0;
         }
+        worker_threads_ = graphics_config.value("worker_threads", worker_threads_);
+        if (worker_threads_ < 0) {
+            spdlog::warn("worker_threads is less than 0, set to 0");
+            worker_threads_ = 0;
+        }
+    }
+
+    if (json.contains("physics")){
+        const auto& physics_config = json["physics"];
+        fixed_timestep_ = physics_config.value("fixed_timestep", fixed_timestep_);
+        physics_hz_ = physics_config.value("hz", physics_hz_);
+        max_substeps_ = physics_config.value("max_substeps", max_substeps_);
+        render_interpolation_ = physics_config.value("interpolation", render_interpolation_);
+        parallel_physics_ = physics_config.value("parallel", parallel_physics_);
+        deterministic_ = physics_config.value("deterministic", deterministic_);
+        if (physics_config.contains("lod")) {
+            const auto& lod_config = physics_config["lod"];
+            simulation_lod_ = lod_config.value("enabled", simulation_lod_);
+            lod_chunk_tiles_ = lod_config.value("chunk_tiles", lod_chunk_tiles_);
+            lod_active_radius_ = lod_config.value("active_radius", lod_active_radius_);
+            lod_reduced_radius_ = lod_config.value("reduced_radius", lod_reduced_radius_);
+            lod_reduced_interval_ = lod_config.value("reduced_interval", lod_reduced_interval_);
+            if (lod_chunk_tiles_ < 1) {
+                spdlog::warn("lod chunk_tiles is less than 1, set to 1");
+                lod_chunk_tiles_ = 1;
+            }
+            if (lod_reduced_interval_ < 1) {
+                spdlog::warn("lod reduced_interval is less than 1, set to 1");
+                lod_reduced_interval_ = 1;
+            }
+        }
+        if (physics_hz_ <= 0) {
+            spdlog::warn("physics hz is less than or equal to 0, set to 60");
+            physics_hz_ = 60;
+        }
+        if (max_substeps_ < 1) {
+            spdlog::warn("max_substeps is less than 1, set to 1");
+            max_substeps_ = 1;
+        }
     }
 
     if (json.contains("audio")){
@@ -121,7 +160,23 @@ nlohmann::ordered_json Config::toJson() const
             {"vsync", vsync_enabled_}
         }},
         {"performance", {
-            {"target_fps", target_fps_}
+            {"target_fps", target_fps_},
+            {"worker_threads", worker_threads_}
+        }},
+        {"physics", {
+            {"fixed_timestep", fixed_timestep_},
+            {"hz", physics_hz_},
+            {"max_substeps", max_substeps_},
+            {"interpolation", render_interpolation_},
+            {"parallel", parallel_physics_},
+            {"deterministic", deterministic_},
+            {"lod", {
+                {"enabled", simulation_lod_},
+                {"chunk_tiles", lod_chunk_tiles_},
+                {"active_radius", lod_active_radius_},
+                {"reduced_radius", lod_reduced_radius_},
+                {"reduced_interval", lod_reduced_interval_}
+            }}
         }},
         {"audio", {
             {"music_volume", music_volume_},
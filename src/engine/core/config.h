@@ -16,6 +16,19 @@ public:
 
     bool vsync_enabled_ = true;
     int target_fps_ = 144;
+    int worker_threads_ = 0;            // 工作线程数（不含主线程），0 表示按硬件线程数自动选择
+
+    bool fixed_timestep_ = true;        // 是否使用固定步长更新游戏逻辑与物理
+    int physics_hz_ = 60;               // 固定步长的频率（每秒步数）
+    int max_substeps_ = 5;              // 每帧最多执行的步数
+    bool render_interpolation_ = true;  // 渲染时是否在两步之间插值
+    bool parallel_physics_ = false;     // 物理步进是否使用工作线程并行执行（物体较少时串行更快，默认关闭）
+    bool simulation_lod_ = true;        // 是否按与相机的距离降低远处实体（刚体及其逻辑）的更新频率
+    int lod_chunk_tiles_ = 16;          // 区块边长（瓦片数）
+    int lod_active_radius_ = 1;         // 距相机视野不超过该区块数时每步更新
+    int lod_reduced_radius_ = 3;        // 不超过该区块数时降频更新，更远则冻结
+    int lod_reduced_interval_ = 4;      // 降频更新的间隔（步）
+    bool deterministic_ = false;        // 确定性模式：强制固定步长，模拟结果只取决于每步的输入（录制/回放时自动启用）
 
     float music_volume_ = 0.5f;
     float sound_volume_ = 0.5f;
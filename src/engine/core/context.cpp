@@ -1,4 +1,5 @@
 #include "context.h"
+#include "time.h"
 #include "../input/input_manager.h"
 #include "../render/renderer.h"
 #include "../render/camera.h"
@@ -6,26 +7,31 @@
 #include "../resource/resource_manager.h"
 #include "../physics/physics_engine.h"
 #include "../audio/audio_player.h"
+#include "thread_pool.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::core
 {
 
     Context::Context(
+        engine::core::Time &time,
         engine::input::InputManager &input_manager,
         engine::render::Renderer &renderer,
         engine::render::Camera &camera,
         engine::render::TextRenderer &text_renderer,
         engine::resource::ResourceManager &resource_manager,
         engine::physics::PhysicsEngine &physics_engine,
-        engine::audio::AudioPlayer &audio_player)
-        : input_manager_(input_manager),
+        engine::audio::AudioPlayer &audio_player,
+        engine::core::ThreadPool &thread_pool)
+        : time_(time),
+          input_manager_(input_manager),
           renderer_(renderer),
           camera_(camera),
           text_renderer_(text_renderer),
           resource_manager_(resource_manager),
           physics_engine_(physics_engine),
-          audio_player_(audio_player)
+          audio_player_(audio_player),
+          thread_pool_(thread_pool)
     {
         spdlog::trace("Context created, include input manager, renderer, camera, resource manager, physics engine");
     }
@@ -29,11 +29,14 @@ namespace engine::audio
 
 namespace engine::core
 {
+    class Time;
+    class ThreadPool;
 
     class Context final
     {
     private:
         // 使用引用，确保每个模块都有效，使用时不需要检查指针是否为空
+        engine::core::Time &time_;
         engine::input::InputManager &input_manager_;
         engine::render::Renderer &renderer_;
         engine::render::Camera &camera_;
@@ -41,17 +44,20 @@ namespace engine::core
         engine::resource::ResourceManager &resource_manager_;
         engine::physics::PhysicsEngine &physics_engine_;
         engine::audio::AudioPlayer &audio_player_;
+        engine::core::ThreadPool &thread_pool_;
 
 
     public:
         Context(
+            engine::core::Time &time,
             engine::input::InputManager &input_manager,
             engine::render::Renderer &renderer,
             engine::render::Camera &camera,
             engine::render::TextRenderer &text_renderer,
             engine::resource::ResourceManager &resource_manager,
             engine::physics::PhysicsEngine &physics_engine,
-            engine::audio::AudioPlayer &audio_player);
+            engine::audio::AudioPlayer &audio_player,
+            engine::core::ThreadPool &thread_pool);
 
         Context(const Context &) = delete;
         Context &operator=(const Context &) = delete;
@@ -59,6 +65,7 @@ namespace engine::core
         Context &operator=(Context &&) = delete;
 
         // getters
+        engine::core::Time &getTime() const { return time_; }
         engine::input::InputManager &getInputManager() const { return input_manager_; }
         engine::render::Renderer &getRenderer() const { return renderer_; }
         engine::render::Camera &getCamera() const { return camera_; }
@@ -66,5 +73,6 @@ namespace engine::core
         engine::resource::ResourceManager &getResourceManager() const { return resource_manager_; }
         engine::physics::PhysicsEngine &getPhysicsEngine() const { return physics_engine_; }
         engine::audio::AudioPlayer &getAudioPlayer() const { return audio_player_; }
+        engine::core::ThreadPool &getThreadPool() const { return thread_pool_; }
     };
 } // namespace engine::core
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <spdlog/spdlog.h>
 
 #include "time.h"
+#include "thread_pool.h"
 #include "config.h"
 #include "context.h"
 #include "../object/game_object.h"
@@ -11,6 +12,7 @@
 #include "../render/renderer.h"
 #include "../render/text_renderer.h"
 #include "../input/input_manager.h"
+#include "../input/input_recorder.h"
 
 #include "../component/transform_component.h"
 #include "../component/sprite_component.h"
@@ -44,13 +46,35 @@ void GameApp::run(){
         return;
     }
 
+    if (!record_path_.empty()) {
+        input_recorder_ = std::make_unique<engine::input::InputRecorder>();
+        input_recorder_->start(*input_manager_, time_->getFixedDeltaTime());
+    }
+
     while (is_running_){
         time_->update();
-        float delta_time = time_->getDeltaTime();
-        input_manager_->update();
 
-        handleEvents();
-        update(delta_time);
+        if (time_->isFixedTimestep()) {
+            // 固定步长：按累加的时间执行若干步（可能为0步），渲染时在两步之间插值。
+            // 事件每帧只轮询一次；“刚按下/刚释放”只在消费它的那一步之后推进，没有执行步时保留到下一步
+            input_manager_->pollEvents();
+            if (input_manager_->shouldQuit()) {
+                handleEvents();
+                continue;
+            }
+            const int steps = time_->consumeFixedSteps();
+            for (int i = 0; i < steps; ++i) {
+                if (input_recorder_) input_recorder_->recordTick(*input_manager_);
+                handleEvents();
+                update(time_->getFixedDeltaTime());
+                if (input_recorder_) input_recorder_->recordStateHash(physics_engine_->computeStateHash());
+                input_manager_->advanceActionStates();
+            }
+        } else {
+            input_manager_->update();
+            handleEvents();
+            update(time_->getDeltaTime());
+        }
         render();
 
         // spdlog::info("GameApp::run() - Frame time: {}", delta_time);
@@ -60,11 +84,61 @@ void GameApp::run(){
 
 }
 
+bool GameApp::runReplay(const std::string &replay_path)
+{
+    input_recorder_ = std::make_unique<engine::input::InputRecorder>();
+    if (!input_recorder_->loadFromFile(replay_path)) {
+        spdlog::error("GameApp::runReplay() - Failed to load replay file: {}", replay_path);
+        return false;
+    }
+    headless_ = true;
+    if (!init()){
+        spdlog::error("GameApp::runReplay() - Failed to initialize the game app");
+        return false;
+    }
+
+    // 使用录制时的步长；输入只来自录制数据（仍然处理窗口的退出事件）
+    const float delta_time = input_recorder_->getFixedDeltaTime();
+    physics_engine_->setDeterministic(true, delta_time);
+    input_manager_->setPlaybackMode(true);
+    audio_player_->setMusicVolume(0.0f);
+    audio_player_->setSoundVolume(0.0f);
+
+    bool matched = true;
+    size_t tick = 0;
+    for (; tick < input_recorder_->getTickCount() && is_running_; ++tick) {
+        input_manager_->update();
+        input_recorder_->applyTick(tick, *input_manager_);
+        handleEvents();
+        update(delta_time);
+
+        const auto state_hash = physics_engine_->computeStateHash();
+        if (state_hash != input_recorder_->getStateHash(tick)) {
+            spdlog::error("GameApp::runReplay() - State hash mismatch at tick {}: expected {:016x}, got {:016x}",
+                          tick, input_recorder_->getStateHash(tick), state_hash);
+            matched = false;
+            break;
+        }
+    }
+    if (matched) {
+        spdlog::info("GameApp::runReplay() - Replay finished, {} ticks matched", tick);
+    }
+
+    close();
+    return matched;
+}
+
+bool GameApp::isDeterministic() const
+{
+    return config_->deterministic_ || headless_ || !record_path_.empty();
+}
+
 bool GameApp::init() {
     spdlog::trace("GameApp::init() - Initializing the game app ... ");
     if (!initConfig()) return false;
     if (!initSDL()) return false;
     if (!initTime()) return false;
+    if (!initThreadPool()) return false;
     if (!initResourceManager()) return false;
     if (!initAudioPlayer()) return false;
     if (!initRenderer()) return false;
@@ -106,12 +180,20 @@ void GameApp::render(){
     // TODO: Implement render logic
 
     renderer_->clearScreen();
+    camera_->updateRenderPosition(time_->getInterpolationAlpha());
     scene_manager_->render();
     renderer_->present();
 }
 
 void GameApp::close(){
     spdlog::trace("GameApp::close() - Closing the game app ... ");
+    // 保存录制的输入（回放时 record_path_ 为空，不会覆盖）
+    if (input_recorder_ && !record_path_.empty()) {
+        if (!input_recorder_->saveToFile(record_path_)) {
+            spdlog::error("GameApp::close() - Failed to save input recording: {}", record_path_);
+        }
+    }
+
     // 先关闭场景管理器，确保所有场景都被清理
     scene_manager_->close();
 
@@ -155,7 +237,9 @@ bool GameApp::initSDL()
         return false;
     }
 
-    window_ = SDL_CreateWindow(config_->window_title_.c_str(),config_->window_width_,config_->window_height_,SDL_WINDOW_RESIZABLE);
+    // 无界面运行时隐藏窗口（纹理加载仍然需要渲染器）
+    const SDL_WindowFlags window_flags = headless_ ? SDL_WINDOW_HIDDEN : SDL_WINDOW_RESIZABLE;
+    window_ = SDL_CreateWindow(config_->window_title_.c_str(),config_->window_width_,config_->window_height_,window_flags);
     if (window_ == nullptr){
         spdlog::error("GameApp::init() - Failed to create window: {}", SDL_GetError());
         return false;
@@ -192,10 +276,31 @@ bool GameApp::initTime(){
         return false;
     }
     time_->setTargetFPS(config_->target_fps_);
+    // 确定性模式下必须使用固定步长，不走按帧时间更新的分支
+    const bool fixed_timestep = config_->fixed_timestep_ || isDeterministic();
+    if (fixed_timestep != config_->fixed_timestep_) {
+        spdlog::info("GameApp::initTime() - Deterministic mode, fixed timestep enabled");
+    }
+    time_->setFixedTimestep(fixed_timestep, config_->physics_hz_, config_->max_substeps_, config_->render_interpolation_);
     spdlog::trace("Time initialized successfully");
     return true;
 }
 
+bool GameApp::initThreadPool()
+{
+    try
+    {
+        thread_pool_ = std::make_unique<ThreadPool>(static_cast<size_t>(config_->worker_threads_));
+    }
+    catch(const std::exception& e)
+    {
+        spdlog::error("GameApp::initThreadPool() - Failed to initialize ThreadPool: {}", e.what());
+        return false;
+    }
+    spdlog::trace("ThreadPool initialized successfully, {} threads", thread_pool_->getThreadCount());
+    return true;
+}
+
 bool GameApp::initResourceManager(){
     try
     {
@@ -302,6 +407,15 @@ bool GameApp::initPhysicsEngine()
         spdlog::error("GameApp::initPhysicsEngine() - Failed to initialize PhysicsEngine: {}", e.what());
         return false;
     }
+    if (config_->parallel_physics_) {
+        physics_engine_->setThreadPool(thread_pool_.get());
+    }
+    if (isDeterministic()) {
+        physics_engine_->setDeterministic(true, time_->getFixedDeltaTime());
+    }
+    physics_engine_->setRegionParams(config_->lod_chunk_tiles_, config_->lod_active_radius_,
+                                     config_->lod_reduced_radius_, config_->lod_reduced_interval_);
+    physics_engine_->setRegionCulling(config_->simulation_lod_);
 
     spdlog::trace("PhysicsEngine initialized successfully");
     return true;
@@ -311,13 +425,15 @@ bool GameApp::initContext()
 {
     try
     {
-        context_ = std::make_unique<engine::core::Context>(*input_manager_,
+        context_ = std::make_unique<engine::core::Context>(*time_,
+                                                           *input_manager_,
                                                            *renderer_,
                                                            *camera_,
                                                            *text_renderer_,
                                                            *resource_manager_,
                                                            *physics_engine_,
-                                                           *audio_player_);
+                                                           *audio_player_,
+                                                           *thread_pool_);
     }
     catch(const std::exception& e)
     {
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <string>
 
 struct SDL_Window;
 struct SDL_Renderer;
@@ -16,6 +17,7 @@ namespace engine::render {
 
 namespace engine::input {
     class InputManager;
+    class InputRecorder;
 }
 
 namespace engine::scene {
@@ -34,12 +36,15 @@ namespace engine::core {
 class Time;
 class Config;
 class Context;
+class ThreadPool;
 
 class GameApp final {
 private:
     SDL_Window *window_ = nullptr;
     SDL_Renderer *sdl_renderer_ = nullptr;
     bool is_running_ = false;
+    bool headless_ = false;         // 无界面运行（隐藏窗口、不渲染，用于回放校验）
+    std::string record_path_;       // 非空时录制每步的输入与状态散列，退出时保存到该文件
 
     // engine::core
     std::unique_ptr<engine::core::Time> time_;
@@ -48,11 +53,13 @@ private:
     std::unique_ptr<engine::render::Camera> camera_;
     std::unique_ptr<engine::render::TextRenderer> text_renderer_;
     std::unique_ptr<engine::core::Config> config_;
+    std::unique_ptr<engine::core::ThreadPool> thread_pool_;
     std::unique_ptr<engine::input::InputManager> input_manager_;
     std::unique_ptr<engine::core::Context> context_;
     std::unique_ptr<engine::scene::SceneManager> scene_manager_;
     std::unique_ptr<engine::physics::PhysicsEngine> physics_engine_;
     std::unique_ptr<engine::audio::AudioPlayer> audio_player_;
+    std::unique_ptr<engine::input::InputRecorder> input_recorder_;
 
 public:
     GameApp();
@@ -60,6 +67,16 @@ public:
 
     void run();
 
+    /// @brief 设置录制文件，run() 期间以确定性模式运行并录制每步的输入动作与状态散列
+    void setRecordPath(const std::string& record_path) { record_path_ = record_path; }
+    /**
+     * @brief 无界面回放：按录制的输入逐步重新模拟关卡，并逐步比较状态散列
+     *
+     * @param replay_path 录制文件
+     * @return bool 所有步的状态散列是否都与录制时一致
+     */
+    [[nodiscard]] bool runReplay(const std::string& replay_path);
+
     // 禁止拷贝和移动
     GameApp(const GameApp &) = delete;
     GameApp &operator=(const GameApp &) = delete;
@@ -72,11 +89,13 @@ private:
     void update(float delta_time);
     void render();
     void close();
+    bool isDeterministic() const;   // 是否以确定性模式运行（配置开启，或正在录制/回放）
 
     // 各模块的初始化/创建函数,在init()中调用
     [[nodiscard]] bool initConfig();
     [[nodiscard]] bool initSDL();
     [[nodiscard]] bool initTime();
+    [[nodiscard]] bool initThreadPool();
     [[nodiscard]] bool initResourceManager();
     [[nodiscard]] bool initAudioPlayer();
     [[nodiscard]] bool initRenderer();
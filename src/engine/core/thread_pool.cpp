@@ -0,0 +1,183 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace engine::core {
+
+namespace {
+    // 当前线程所属的线程池及其队列编号
+    thread_local const ThreadPool* current_system = nullptr;
+    thread_local size_t current_queue = 0;
+
+    constexpr int IDLE_SPINS = 64;      // 工作线程找不到任务时，进入休眠之前让出时间片的次数
+} // namespace
+
+ThreadPool::ThreadPool(size_t worker_count)
+{
+    if (worker_count == 0) {
+        const auto hardware_threads = std::thread::hardware_concurrency();
+        worker_count = hardware_threads > 1 ? hardware_threads - 1 : 0;
+    }
+    queues_.reserve(worker_count + 1);
+    for (size_t i = 0; i <= worker_count; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    current_system = this;
+    current_queue = 0;
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this, i + 1);
+    }
+    spdlog::trace("ThreadPool created with {} worker threads", worker_count);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    if (current_system == this) current_system = nullptr;
+}
+
+void ThreadPool::run(JobCounter &counter, JobFunction function, void *data, size_t index)
+{
+    counter.pending_.fetch_add(1, std::memory_order_relaxed);
+    push(currentQueue(), Job{function, data, index, &counter});
+}
+
+void ThreadPool::run(JobCounter &counter, std::function<void()> task)
+{
+    auto* owned = new std::function<void()>(std::move(task));
+    run(counter, [](void* data, size_t) {
+        std::unique_ptr<std::function<void()>> task(static_cast<std::function<void()>*>(data));
+        (*task)();
+    }, owned);
+}
+
+void ThreadPool::wait(JobCounter &counter)
+{
+    const auto queue_index = currentQueue();
+    Job job;
+    while (!counter.isDone()) {
+        if (tryTake(queue_index, job)) {
+            execute(job);
+        } else {
+            // 剩余的任务正由其他线程执行
+            std::this_thread::yield();
+        }
+    }
+}
+
+size_t ThreadPool::parallelFor(size_t count, size_t min_batch, const RangeTask &task)
+{
+    if (count == 0) return 0;
+    min_batch = std::max<size_t>(min_batch, 1);
+    const size_t chunk_count = std::min(getThreadCount(), (count + min_batch - 1) / min_batch);
+    if (chunk_count <= 1) {
+        task(0, count, 0);
+        return 1;
+    }
+
+    // 块 k 处理 [count * k / n, count * (k+1) / n)，保证块间连续且有序
+    struct RangeJob {
+        const RangeTask* task;
+        size_t count;
+        size_t chunk_count;
+    } range{&task, count, chunk_count};
+    const JobFunction run_chunk = [](void* data, size_t chunk) {
+        const auto& job = *static_cast<const RangeJob*>(data);
+        (*job.task)(job.count * chunk / job.chunk_count, job.count * (chunk + 1) / job.chunk_count, chunk);
+    };
+
+    JobCounter counter;
+    for (size_t chunk = 1; chunk < chunk_count; ++chunk) {
+        run(counter, run_chunk, &range, chunk);
+    }
+    run_chunk(&range, 0);
+    wait(counter);
+    return chunk_count;
+}
+
+void ThreadPool::workerLoop(size_t queue_index)
+{
+    current_system = this;
+    current_queue = queue_index;
+    Job job;
+    int idle_spins = 0;
+    while (true) {
+        if (tryTake(queue_index, job)) {
+            execute(job);
+            idle_spins = 0;
+            continue;
+        }
+        if (++idle_spins < IDLE_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+        idle_spins = 0;
+        std::unique_lock lock(sleep_mutex_);
+        // 先登记为休眠再检查任务数；与 push 中“先入队再检查休眠数”配对，二者至少有一方能看到对方，通知不会丢失
+        sleeping_workers_.fetch_add(1, std::memory_order_seq_cst);
+        sleep_cv_.wait(lock, [this] { return stopping_ || queued_jobs_.load(std::memory_order_seq_cst) > 0; });
+        sleeping_workers_.fetch_sub(1, std::memory_order_relaxed);
+        if (stopping_) return;
+    }
+}
+
+size_t ThreadPool::currentQueue() const
+{
+    return current_system == this ? current_queue : 0;
+}
+
+void ThreadPool::push(size_t queue_index, const Job &job)
+{
+    {
+        std::lock_guard lock(queues_[queue_index]->mutex);
+        queues_[queue_index]->jobs.push_back(job);
+    }
+    queued_jobs_.fetch_add(1, std::memory_order_seq_cst);
+    if (sleeping_workers_.load(std::memory_order_seq_cst) > 0) {
+        // 与 workerLoop 中的判断互斥，避免通知在工作线程检查条件之后、进入等待之前丢失
+        { std::lock_guard lock(sleep_mutex_); }
+        sleep_cv_.notify_one();
+    }
+}
+
+bool ThreadPool::tryTake(size_t queue_index, Job &job)
+{
+    if (queued_jobs_.load(std::memory_order_acquire) == 0) return false;
+    {
+        auto& own = *queues_[queue_index];
+        std::lock_guard lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+        auto& victim = *queues_[(queue_index + offset) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::execute(const Job &job)
+{
+    job.function(job.data, job.index);
+    if (job.counter) job.counter->pending_.fetch_sub(1, std::memory_order_release);
+}
+
+}   // namespace engine::core
@@ -0,0 +1,122 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::core {
+
+/**
+ * @brief 任务计数器：记录关联的任务中尚未完成的数量，用于等待一组任务（也用来表达任务之间的依赖）
+ */
+class JobCounter final {
+    friend class ThreadPool;
+
+private:
+    std::atomic<std::uint32_t> pending_{0};
+
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool isDone() const { return pending_.load(std::memory_order_acquire) == 0; }
+};
+
+/**
+ * @brief 工作窃取（work stealing）线程池
+ *
+ * 每个线程（工作线程与创建线程池的主线程）拥有一个任务队列：线程从自己队列的尾部取任务（后进先出，缓存更热），
+ * 自己的队列为空时从其他线程队列的头部窃取。任务通过 JobCounter 分组，wait() 在等待期间会继续执行任务
+ * （“边等边做”），因此任务内部也可以提交子任务并等待，依赖关系通过“先等待依赖的计数器”表达，不会死锁。
+ *
+ * parallelFor 的区间被切分为连续且有序的块，块编号与区间位置一一对应（块 k 总在块 k+1 之前），
+ * 调用者按块编号合并结果即可得到与串行执行相同的结果，与线程数无关。
+ * 只有确实有工作线程在休眠时，提交任务才会加锁并唤醒，忙碌时提交任务只需一次入队。
+ */
+class ThreadPool final {
+public:
+    /// @brief 任务函数：data 为任务数据，index 为任务序号（由提交者解释）
+    using JobFunction = void (*)(void* data, size_t index);
+    /// @brief 区间任务回调：处理 [begin, end) 区间，chunk 为块编号（0 ~ 块数-1）
+    using RangeTask = std::function<void(size_t begin, size_t end, size_t chunk)>;
+
+private:
+    struct Job {
+        JobFunction function = nullptr;
+        void* data = nullptr;
+        size_t index = 0;
+        JobCounter* counter = nullptr;
+    };
+
+    /// @brief 单个线程的任务队列（所有者在尾部存取，其他线程从头部窃取）
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;    // 0 为主线程，1 ~ n 为工作线程
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> queued_jobs_{0};    // 所有队列中的任务总数（用于决定工作线程是否休眠）
+    std::atomic<size_t> sleeping_workers_{0};   // 正在（或即将）休眠的工作线程数，为 0 时提交任务无需唤醒
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;      // 通知休眠的工作线程有新任务
+    bool stopping_ = false;                 // 由 sleep_mutex_ 保护
+
+public:
+    /**
+     * @brief 创建线程池（调用线程成为主线程）
+     *
+     * @param worker_count 工作线程数（不含主线程），0 表示按硬件线程数自动选择
+     */
+    explicit ThreadPool(size_t worker_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// @brief 参与执行的线程总数（工作线程 + 主线程），也是 parallelFor 的最大块数
+    size_t getThreadCount() const { return workers_.size() + 1; }
+
+    /**
+     * @brief 提交任务（不分配内存）
+     *
+     * @param counter 任务完成时递减的计数器（提交时递增）
+     * @param function 任务函数
+     * @param data 任务数据，须在任务完成前保持有效
+     * @param index 任务序号
+     */
+    void run(JobCounter& counter, JobFunction function, void* data, size_t index = 0);
+    /// @brief 提交任意可调用对象（会为其分配一次内存）
+    void run(JobCounter& counter, std::function<void()> task);
+
+    /// @brief 等待计数器归零，等待期间执行队列中的任务
+    void wait(JobCounter& counter);
+
+    /**
+     * @brief 将 [0, count) 切分为连续的块并行执行，全部完成后返回（可在任务中嵌套调用）
+     *
+     * @param count 元素总数
+     * @param min_batch 每块最少元素数，元素太少时直接在调用线程串行执行
+     * @param task 任务回调
+     * @return size_t 实际使用的块数（调用者据此合并各块的结果）
+     */
+    size_t parallelFor(size_t count, size_t min_batch, const RangeTask& task);
+
+private:
+    void workerLoop(size_t queue_index);
+    size_t currentQueue() const;                        // 当前线程的队列（非本系统的线程使用主线程队列）
+    void push(size_t queue_index, const Job& job);
+    bool tryTake(size_t queue_index, Job& job);         // 先取自己队列的尾部，再从其他队列的头部窃取
+    static void execute(const Job& job);
+};
+
+}   // namespace engine::core
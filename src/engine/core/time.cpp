@@ -1,6 +1,7 @@
 #include "time.h"
 #include <SDL3/SDL_timer.h>
 #include <spdlog/spdlog.h>
+#include <cmath>
 
 namespace engine::core {
 
@@ -65,4 +66,44 @@ void Time::setTargetFPS(int target_fps) {
     spdlog::info("Target FPS set to: {}, target frame time: {}", target_fps, target_frame_time_);
 }
 
+void Time::setFixedTimestep(bool enabled, int step_hz, int max_substeps, bool interpolation)
+{
+    if (step_hz <= 0) {
+        spdlog::warn("Fixed timestep hz must be positive. Ignoring value: {}", step_hz);
+        step_hz = static_cast<int>(std::round(1.0 / fixed_delta_time_));
+    }
+    if (max_substeps < 1) {
+        spdlog::warn("Max substeps must be at least 1. Ignoring value: {}", max_substeps);
+        max_substeps = max_substeps_;
+    }
+    fixed_timestep_ = enabled;
+    fixed_delta_time_ = 1.0 / static_cast<double>(step_hz);
+    max_substeps_ = max_substeps;
+    interpolation_enabled_ = interpolation;
+    accumulator_ = 0.0;
+    interpolation_alpha_ = 1.0f;
+
+    spdlog::info("Fixed timestep {}: {} Hz, max substeps: {}, interpolation: {}",
+                 enabled ? "enabled" : "disabled", step_hz, max_substeps_, interpolation_enabled_);
+}
+
+int Time::consumeFixedSteps()
+{
+    accumulator_ += delta_time_ * time_scale_;
+
+    int steps = 0;
+    while (accumulator_ >= fixed_delta_time_ && steps < max_substeps_) {
+        accumulator_ -= fixed_delta_time_;
+        ++steps;
+    }
+    if (accumulator_ >= fixed_delta_time_) {
+        // 本帧耗时过长（如窗口拖动、断点），丢弃追不上的时间，只保留不足一步的部分
+        spdlog::debug("Time::consumeFixedSteps() - dropping {:.3f}s of simulation time", accumulator_ - std::fmod(accumulator_, fixed_delta_time_));
+        accumulator_ = std::fmod(accumulator_, fixed_delta_time_);
+    }
+
+    interpolation_alpha_ = interpolation_enabled_ ? static_cast<float>(accumulator_ / fixed_delta_time_) : 1.0f;
+    return steps;
+}
+
 } // namespace engine::core
@@ -13,6 +13,14 @@ private:
     int target_fps_ = 0;  // target fps
     double target_frame_time_ = 0.0;  // target time between frames
 
+    // 固定步长模拟
+    bool fixed_timestep_ = false;       // 是否启用固定步长
+    double fixed_delta_time_ = 1.0 / 60.0;  // 每一步的时间（秒）
+    int max_substeps_ = 5;              // 每帧最多执行的步数，超出的积压时间会被丢弃（避免“死亡螺旋”）
+    double accumulator_ = 0.0;          // 尚未模拟的时间
+    bool interpolation_enabled_ = true; // 渲染时是否在两步之间插值
+    float interpolation_alpha_ = 1.0f;  // 渲染插值因子（0 表示上一步，1 表示当前步）
+
 public:
     Time();
 
@@ -31,6 +39,25 @@ public:
     int getTargetFPS() const;
     void setTargetFPS(int target_fps);
 
+    /**
+     * @brief 设置固定步长模拟
+     *
+     * @param enabled 是否启用，不启用时每帧使用可变的 delta_time 更新一次
+     * @param step_hz 每秒模拟步数
+     * @param max_substeps 每帧最多执行的步数
+     * @param interpolation 渲染时是否插值
+     */
+    void setFixedTimestep(bool enabled, int step_hz, int max_substeps, bool interpolation = true);
+    bool isFixedTimestep() const { return fixed_timestep_; }
+    float getFixedDeltaTime() const { return static_cast<float>(fixed_delta_time_); }
+    int getMaxSubsteps() const { return max_substeps_; }
+
+    /**
+     * @brief 将本帧经过的时间（已乘时间缩放）加入累加器，返回本帧需要执行的固定步数，并更新渲染插值因子
+     */
+    int consumeFixedSteps();
+    float getInterpolationAlpha() const { return interpolation_alpha_; }
+
 private:
     void limitFrameRate(float current_delta_time);
 };
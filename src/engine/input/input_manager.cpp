@@ -2,6 +2,7 @@
 #include "../core/config.h"
 #include <SDL3/SDL.h>
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 namespace engine::input {
 InputManager::InputManager(SDL_Renderer *sdl_renderer, const engine::core::Config *config)
@@ -20,6 +21,20 @@ InputManager::InputManager(SDL_Renderer *sdl_renderer, const engine::core::Confi
 }
 
 void InputManager::update()
+{
+    advanceActionStates();
+    pollEvents();
+}
+
+void InputManager::pollEvents()
+{
+    SDL_Event event;
+    while (SDL_PollEvent(&event)) {
+        processEvent(event);
+    }
+}
+
+void InputManager::advanceActionStates()
 {
     for (auto &[action, state] : action_states_) {
         if (state == ActionState::PRESSED_THIS_FRAME) {
@@ -28,11 +43,6 @@ void InputManager::update()
             state = ActionState::INACTIVE;
         }
     }
-
-    SDL_Event event;
-    while (SDL_PollEvent(&event)) {
-        processEvent(event);
-    }
 }
 
 bool InputManager::isActionDown(const std::string &action_name) const
@@ -59,6 +69,35 @@ bool InputManager::isActionReleased(const std::string &action_name) const
     return false;
 }
 
+std::vector<std::string> InputManager::getActionNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(action_states_.size());
+    for (const auto &[action, state] : action_states_) {
+        names.push_back(action);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+ActionState InputManager::getActionState(const std::string &action_name) const
+{
+    if (auto it = action_states_.find(action_name); it != action_states_.end()) {
+        return it->second;
+    }
+    return ActionState::INACTIVE;
+}
+
+void InputManager::setActionState(const std::string &action_name, ActionState state)
+{
+    auto it = action_states_.find(action_name);
+    if (it == action_states_.end()) {
+        spdlog::warn("InputManager: Try to set Action {} which is not registered", action_name);
+        return;
+    }
+    it->second = state;
+}
+
 bool InputManager::shouldQuit() const
 {
     return should_quit_;
@@ -88,6 +127,7 @@ void InputManager::processEvent(const SDL_Event &event)
     {
     case SDL_EVENT_KEY_DOWN:
     case SDL_EVENT_KEY_UP: {
+        if (playback_mode_) break;  // 回放时动作状态来自录制数据
         SDL_Scancode scancode = event.key.scancode;
         bool is_down = event.key.down;
         bool is_repeat = event.key.repeat;
@@ -103,6 +143,7 @@ void InputManager::processEvent(const SDL_Event &event)
     }
     case SDL_EVENT_MOUSE_BUTTON_DOWN:
     case SDL_EVENT_MOUSE_BUTTON_UP: {
+        if (playback_mode_) break;
         Uint32 mouse_button = event.button.button;
         bool is_mouse_down = event.button.down;
         auto it = input_to_actions_map_.find(mouse_button);
@@ -115,6 +156,7 @@ void InputManager::processEvent(const SDL_Event &event)
         break;
     }
     case SDL_EVENT_MOUSE_MOTION:
+        if (playback_mode_) break;
         mouse_position_ = {event.motion.x, event.motion.y};
         break;
     case SDL_EVENT_QUIT:
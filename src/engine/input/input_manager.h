@@ -31,12 +31,15 @@ namespace engine::input
         std::unordered_map<std::string, ActionState> action_states_; // 存储每个动作的当前状态
 
         bool should_quit_ = false; // 退出标志
+        bool playback_mode_ = false; // 回放模式：忽略键盘/鼠标事件，动作状态与鼠标位置由回放数据设置
         glm::vec2 mouse_position_; // 鼠标位置(针对窗口坐标)
 
     public:
         InputManager(SDL_Renderer *sdl_renderer, const engine::core::Config *config);
 
-        void update(); // 更新输入状态
+        void update(); // 更新输入状态（advanceActionStates 后 pollEvents，用于每帧只执行一次逻辑更新的情况）
+        void pollEvents();          // 处理 SDL 事件队列中的所有事件（每帧一次）
+        void advanceActionStates(); // 将“刚按下/刚释放”推进为“持续按下/未激活”（在消费了这些状态的一步之后调用）
 
         bool isActionDown(const std::string &action_name) const;     // 检查动作是否触发(持续按住或者刚刚按下)
         bool isActionPressed(const std::string &action_name) const;  // 检查动作是否在此帧被按下
@@ -45,6 +48,14 @@ namespace engine::input
         bool shouldQuit() const;              // 查询退出状态
         void setShouldQuit(bool should_quit); // 设置退出状态
 
+        // --- 录制与回放 ---
+        std::vector<std::string> getActionNames() const;                        // 获取所有动作名(按名称排序，顺序与散列表无关)
+        ActionState getActionState(const std::string &action_name) const;       // 获取动作的当前状态(未注册的动作返回 INACTIVE)
+        void setActionState(const std::string &action_name, ActionState state); // 直接设置动作状态(回放时使用)
+        void setMousePosition(const glm::vec2 &mouse_position) { mouse_position_ = mouse_position; } // 直接设置鼠标位置(回放时使用)
+        void setPlaybackMode(bool playback_mode) { playback_mode_ = playback_mode; }
+        bool isPlaybackMode() const { return playback_mode_; }
+
         glm::vec2 getMousePosition() const;        // 获取鼠标位置(屏幕坐标)
         glm::vec2 getLogicalMousePosition() const; // 获取鼠标位置(逻辑坐标)
 
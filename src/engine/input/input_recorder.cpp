@@ -0,0 +1,135 @@
+#include "input_recorder.h"
+#include "input_manager.h"
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::input {
+
+void InputRecorder::start(const InputManager &input_manager, float fixed_delta_time)
+{
+    fixed_delta_time_ = fixed_delta_time;
+    action_names_ = input_manager.getActionNames();
+    tick_offsets_.assign(1, 0u);
+    actions_.clear();
+    mouse_positions_.clear();
+    state_hashes_.clear();
+    spdlog::info("InputRecorder: Start recording, {} actions, dt = {}", action_names_.size(), fixed_delta_time_);
+}
+
+void InputRecorder::recordTick(const InputManager &input_manager)
+{
+    for (size_t i = 0; i < action_names_.size(); ++i) {
+        auto state = input_manager.getActionState(action_names_[i]);
+        if (state == ActionState::INACTIVE) continue;
+        actions_.push_back(ActionEntry{static_cast<std::uint16_t>(i), static_cast<std::uint8_t>(state)});
+    }
+    tick_offsets_.push_back(static_cast<std::uint32_t>(actions_.size()));
+    mouse_positions_.push_back(input_manager.getMousePosition());
+}
+
+void InputRecorder::recordStateHash(std::uint64_t state_hash)
+{
+    state_hashes_.push_back(state_hash);
+}
+
+void InputRecorder::applyTick(size_t tick, InputManager &input_manager) const
+{
+    for (const auto& name : action_names_) {
+        input_manager.setActionState(name, ActionState::INACTIVE);
+    }
+    for (auto i = tick_offsets_[tick]; i < tick_offsets_[tick + 1]; ++i) {
+        input_manager.setActionState(action_names_[actions_[i].action], static_cast<ActionState>(actions_[i].state));
+    }
+    input_manager.setMousePosition(mouse_positions_[tick]);
+}
+
+bool InputRecorder::saveToFile(const std::string &file_path) const
+{
+    std::ofstream file(file_path);
+    if (!file.is_open()) {
+        spdlog::error("InputRecorder: Failed to open replay file '{}' to save", file_path);
+        return false;
+    }
+
+    // 只保存既有动作又有状态散列的完整步
+    nlohmann::json ticks = nlohmann::json::array();
+    nlohmann::json mouse_positions = nlohmann::json::array();
+    for (size_t tick = 0; tick < getTickCount() && tick + 1 < tick_offsets_.size(); ++tick) {
+        nlohmann::json entries = nlohmann::json::array();
+        for (auto i = tick_offsets_[tick]; i < tick_offsets_[tick + 1]; ++i) {
+            entries.push_back(actions_[i].action);
+            entries.push_back(actions_[i].state);
+        }
+        ticks.push_back(std::move(entries));
+        mouse_positions.push_back(mouse_positions_[tick].x);
+        mouse_positions.push_back(mouse_positions_[tick].y);
+    }
+
+    nlohmann::ordered_json json{
+        {"fixed_delta_time", fixed_delta_time_},
+        {"actions", action_names_},
+        {"ticks", std::move(ticks)},
+        {"mouse_positions", std::move(mouse_positions)},
+        {"state_hashes", state_hashes_},
+    };
+    file << json.dump();
+    spdlog::info("InputRecorder: Saved {} ticks to '{}'", getTickCount(), file_path);
+    return true;
+}
+
+bool InputRecorder::loadFromFile(const std::string &file_path)
+{
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        spdlog::error("InputRecorder: Failed to open replay file '{}'", file_path);
+        return false;
+    }
+
+    try
+    {
+        nlohmann::json json;
+        file >> json;
+        fixed_delta_time_ = json.at("fixed_delta_time").get<float>();
+        action_names_ = json.at("actions").get<std::vector<std::string>>();
+        state_hashes_ = json.at("state_hashes").get<std::vector<std::uint64_t>>();
+
+        const auto& ticks = json.at("ticks");
+        if (ticks.size() != state_hashes_.size()) {
+            spdlog::error("InputRecorder: Replay file '{}' has {} ticks but {} state hashes", file_path, ticks.size(), state_hashes_.size());
+            return false;
+        }
+        const auto mouse_positions = json.at("mouse_positions").get<std::vector<float>>();
+        if (mouse_positions.size() != 2 * ticks.size()) {
+            spdlog::error("InputRecorder: Replay file '{}' has {} ticks but {} mouse coordinates", file_path, ticks.size(), mouse_positions.size());
+            return false;
+        }
+        mouse_positions_.clear();
+        for (size_t i = 0; i < mouse_positions.size(); i += 2) {
+            mouse_positions_.push_back({mouse_positions[i], mouse_positions[i + 1]});
+        }
+        tick_offsets_.assign(1, 0u);
+        actions_.clear();
+        for (const auto& entries : ticks) {
+            for (size_t i = 0; i + 1 < entries.size(); i += 2) {
+                auto action = entries[i].get<std::uint16_t>();
+                if (action >= action_names_.size()) {
+                    spdlog::error("InputRecorder: Invalid action index {} in replay file '{}'", action, file_path);
+                    return false;
+                }
+                actions_.push_back(ActionEntry{action, entries[i + 1].get<std::uint8_t>()});
+            }
+            tick_offsets_.push_back(static_cast<std::uint32_t>(actions_.size()));
+        }
+    }
+    catch(const std::exception& e)
+    {
+        spdlog::error("InputRecorder: Failed to load replay file '{}', error: {}", file_path, e.what());
+        return false;
+    }
+
+    spdlog::info("InputRecorder: Loaded {} ticks from '{}'", getTickCount(), file_path);
+    return true;
+}
+
+} // namespace engine::input
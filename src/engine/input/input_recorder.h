@@ -0,0 +1,66 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::input {
+    class InputManager;
+    enum class ActionState;
+
+/**
+ * @brief 输入录制与回放数据
+ *
+ * 以固定步长为单位，记录每一步开始时所有非 INACTIVE 的动作状态与鼠标位置，以及该步结束时的模拟状态散列。
+ * 回放时按步把动作状态与鼠标位置写回 InputManager，重新模拟后逐步比较状态散列。
+ * 状态散列只覆盖物理状态（PhysicsEngine::computeStateHash），生命值、AI 状态、动画等不影响刚体的状态不参与比较，
+ * 它们的分歧要等到影响了刚体之后才会被发现。
+ * 数据以 JSON 保存，动作按名称索引（录制时的动作名列表按名称排序，与散列表顺序无关）。
+ */
+class InputRecorder final {
+private:
+    /// @brief 一个动作在某一步的状态
+    struct ActionEntry {
+        std::uint16_t action;       // action_names_ 中的下标
+        std::uint8_t state;         // ActionState
+    };
+
+    float fixed_delta_time_ = 0.0f;             // 录制时的固定步长（秒）
+    std::vector<std::string> action_names_;     // 动作名（排序后）
+    std::vector<std::uint32_t> tick_offsets_;   // 第 i 步的动作位于 [offsets[i], offsets[i + 1])
+    std::vector<ActionEntry> actions_;          // 所有步的非 INACTIVE 动作
+    std::vector<glm::vec2> mouse_positions_;    // 每一步的鼠标位置（窗口坐标）
+    std::vector<std::uint64_t> state_hashes_;   // 每一步结束时的状态散列
+
+public:
+    InputRecorder() = default;
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+    InputRecorder(InputRecorder&&) = delete;
+    InputRecorder& operator=(InputRecorder&&) = delete;
+
+    /**
+     * @brief 清空数据，开始新的录制
+     *
+     * @param input_manager 从中读取动作名
+     * @param fixed_delta_time 模拟使用的固定步长
+     */
+    void start(const InputManager& input_manager, float fixed_delta_time);
+    void recordTick(const InputManager& input_manager);     // 记录本步的动作状态与鼠标位置（在输入更新之后、逻辑更新之前调用）
+    void recordStateHash(std::uint64_t state_hash);         // 记录本步结束时的状态散列
+
+    /**
+     * @brief 将第 tick 步的动作状态与鼠标位置写入 InputManager（未记录的动作设为 INACTIVE）
+     */
+    void applyTick(size_t tick, InputManager& input_manager) const;
+
+    [[nodiscard]] bool saveToFile(const std::string& file_path) const;
+    [[nodiscard]] bool loadFromFile(const std::string& file_path);
+
+    size_t getTickCount() const { return state_hashes_.size(); }
+    std::uint64_t getStateHash(size_t tick) const { return state_hashes_[tick]; }
+    float getFixedDeltaTime() const { return fixed_delta_time_; }
+};
+
+} // namespace engine::input
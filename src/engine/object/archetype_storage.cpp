@@ -0,0 +1,89 @@
+#include "archetype_storage.h"
+#include "game_object.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::object {
+
+    ArchetypeStorage::~ArchetypeStorage()
+    {
+        // 存储先于游戏对象销毁时，解除对象对存储的引用
+        for (auto& archetype : archetypes_) {
+            for (auto* game_object : archetype.entities) {
+                game_object->archetype_storage_ = nullptr;
+            }
+        }
+    }
+
+    void ArchetypeStorage::insert(GameObject *game_object)
+    {
+        if (game_object->archetype_storage_ == this) return;
+        if (game_object->archetype_storage_) {
+            spdlog::warn("ArchetypeStorage: game object {} already belongs to another storage, moving it", game_object->getName());
+            game_object->archetype_storage_->erase(game_object);
+        }
+        pushRow(archetypeFor(game_object->component_mask_), game_object);
+        game_object->archetype_storage_ = this;
+        ++entity_count_;
+    }
+
+    void ArchetypeStorage::erase(GameObject *game_object)
+    {
+        if (game_object->archetype_storage_ != this) return;
+        removeRow(game_object);
+        game_object->archetype_storage_ = nullptr;
+        --entity_count_;
+    }
+
+    void ArchetypeStorage::refresh(GameObject *game_object)
+    {
+        if (game_object->archetype_storage_ != this) return;
+        removeRow(game_object);
+        pushRow(archetypeFor(game_object->component_mask_), game_object);
+    }
+
+    std::uint32_t ArchetypeStorage::archetypeFor(std::uint32_t mask)
+    {
+        if (auto it = archetype_of_mask_.find(mask); it != archetype_of_mask_.end()) {
+            return it->second;
+        }
+        const auto index = static_cast<std::uint32_t>(archetypes_.size());
+        auto& archetype = archetypes_.emplace_back();
+        archetype.mask = mask;
+        archetype.columns.resize(static_cast<size_t>(std::popcount(mask)));
+        archetype_of_mask_.emplace(mask, index);
+        spdlog::trace("ArchetypeStorage: new archetype {} with mask {:#x}", index, mask);
+        return index;
+    }
+
+    void ArchetypeStorage::pushRow(std::uint32_t archetype_index, GameObject *game_object)
+    {
+        auto& archetype = archetypes_[archetype_index];
+        game_object->archetype_ = archetype_index;
+        game_object->archetype_row_ = static_cast<std::uint32_t>(archetype.entities.size());
+        archetype.entities.push_back(game_object);
+        // 按类型编号从小到大依次填入各列
+        size_t column = 0;
+        for (auto bits = archetype.mask; bits != 0; bits &= bits - 1, ++column) {
+            archetype.columns[column].push_back(game_object->component_slots_[std::countr_zero(bits)]);
+        }
+    }
+
+    void ArchetypeStorage::removeRow(GameObject *game_object)
+    {
+        auto& archetype = archetypes_[game_object->archetype_];
+        const auto row = game_object->archetype_row_;
+        const auto last = archetype.entities.size() - 1;
+        if (row != last) {
+            archetype.entities[row] = archetype.entities[last];
+            archetype.entities[row]->archetype_row_ = row;
+            for (auto& column : archetype.columns) {
+                column[row] = column[last];
+            }
+        }
+        archetype.entities.pop_back();
+        for (auto& column : archetype.columns) {
+            column.pop_back();
+        }
+    }
+
+}   // namespace engine::object
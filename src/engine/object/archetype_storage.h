@@ -0,0 +1,81 @@
+#pragma once
+#include "../component/component.h"
+#include <bit>
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::object {
+    class GameObject;
+
+/**
+ * @brief 按原型（archetype，即拥有的组件类型集合）分组的实体索引，由 Scene 拥有
+ *
+ * 组件集合相同的游戏对象归入同一原型，原型内每个组件类型一列，增删实体与组件时采用“与末尾交换后弹出”。
+ * 系统通过 each<Ts...>() 只遍历包含所需组件的原型，无需逐个对象查询、筛选组件。
+ *
+ * 这里只是索引：列中保存的是组件指针，组件本身仍由 ComponentPool 按类型分块存放（组件不可移动，地址须保持不变），
+ * 遍历时每个组件仍是一次间接访问，内存顺序取决于组件的创建顺序而非原型。
+ * GameObject 在组件变化或被清理时会自动更新自己的位置。
+ */
+class ArchetypeStorage final {
+private:
+    struct Archetype {
+        std::uint32_t mask = 0;                                     // 组件类型掩码
+        std::vector<GameObject*> entities;                          // 每行的游戏对象
+        std::vector<std::vector<engine::component::Component*>> columns;    // 按组件类型编号从小到大，每个类型一列
+
+        /// @brief 组件类型在 columns 中的列号（须属于该原型）
+        size_t columnOf(engine::component::ComponentTypeId type_id) const {
+            return static_cast<size_t>(std::popcount(mask & ((1u << type_id) - 1u)));
+        }
+    };
+
+    std::vector<Archetype> archetypes_;
+    std::unordered_map<std::uint32_t, std::uint32_t> archetype_of_mask_;   // 掩码 -> archetypes_ 下标
+    size_t entity_count_ = 0;
+
+public:
+    ArchetypeStorage() = default;
+    ~ArchetypeStorage();
+
+    ArchetypeStorage(const ArchetypeStorage&) = delete;
+    ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+    ArchetypeStorage(ArchetypeStorage&&) = delete;
+    ArchetypeStorage& operator=(ArchetypeStorage&&) = delete;
+
+    void insert(GameObject* game_object);       // 加入存储（按当前拥有的组件归入原型）
+    void erase(GameObject* game_object);        // 移出存储
+    void refresh(GameObject* game_object);      // 游戏对象的组件集合变化后，将其移动到新的原型
+
+    /**
+     * @brief 遍历所有同时拥有 Ts... 组件的游戏对象，调用 func(GameObject&, Ts&...)
+     *
+     * 遍历期间不能增删游戏对象或其组件（包括清理对象）。
+     */
+    template<typename... Ts, typename Func>
+    void each(Func&& func) {
+        const std::uint32_t required = ((1u << engine::component::component_type_id<Ts>) | ... | 0u);
+        for (auto& archetype : archetypes_) {
+            if ((archetype.mask & required) != required || archetype.entities.empty()) continue;
+            auto columns = std::make_tuple(archetype.columns[archetype.columnOf(engine::component::component_type_id<Ts>)].data()...);
+            const size_t count = archetype.entities.size();
+            for (size_t row = 0; row < count; ++row) {
+                std::apply([&](auto*... column) {
+                    func(*archetype.entities[row], *static_cast<Ts*>(column[row])...);
+                }, columns);
+            }
+        }
+    }
+
+    size_t getEntityCount() const { return entity_count_; }
+    size_t getArchetypeCount() const { return archetypes_.size(); }
+
+private:
+    std::uint32_t archetypeFor(std::uint32_t mask);             // 取得（必要时创建）掩码对应的原型
+    void pushRow(std::uint32_t archetype_index, GameObject* game_object);
+    void removeRow(GameObject* game_object);
+};
+
+}   // namespace engine::object
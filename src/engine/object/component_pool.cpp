@@ -0,0 +1,43 @@
+#include "component_pool.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::object {
+
+    ComponentPool::ComponentPool(size_t slot_size, size_t slot_align)
+        : slot_size_((slot_size + slot_align - 1) / slot_align * slot_align), slot_align_(slot_align)
+    {
+    }
+
+    ComponentPool::~ComponentPool()
+    {
+        if (live_count_ > 0) {
+            spdlog::warn("ComponentPool: {} components still alive when the pool is destroyed", live_count_);
+        }
+        for (void* chunk : chunks_) {
+            ::operator delete(chunk, std::align_val_t(slot_align_));
+        }
+    }
+
+    void* ComponentPool::allocate()
+    {
+        if (free_slots_.empty()) {
+            auto* chunk = static_cast<std::byte*>(::operator new(slot_size_ * SLOTS_PER_CHUNK, std::align_val_t(slot_align_)));
+            chunks_.push_back(chunk);
+            // 倒序压栈，使块内按地址递增的顺序分配
+            for (size_t i = SLOTS_PER_CHUNK; i-- > 0;) {
+                free_slots_.push_back(chunk + i * slot_size_);
+            }
+        }
+        void* slot = free_slots_.back();
+        free_slots_.pop_back();
+        ++live_count_;
+        return slot;
+    }
+
+    void ComponentPool::deallocate(void* slot)
+    {
+        free_slots_.push_back(slot);
+        --live_count_;
+    }
+
+}   // namespace engine::object
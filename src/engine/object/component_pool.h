@@ -0,0 +1,77 @@
+#pragma once
+#include "../component/component.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace engine::object {
+
+/**
+ * @brief 同一组件类型的分块内存池
+ *
+ * 每块连续存放若干个同类型组件，释放的槽位放入空闲表后复用，同类型组件因此在内存中紧凑排列，
+ * 按类型遍历时局部性远好于逐个 new。组件地址在其生命周期内保持不变（组件之间互相缓存了指针，不能移动）。
+ * 池按类型全局唯一（ComponentPool::of<T>()），只应在主线程中创建与销毁组件。
+ */
+class ComponentPool final {
+private:
+    static constexpr size_t SLOTS_PER_CHUNK = 64;   // 每块的槽位数
+
+    size_t slot_size_;                      // 槽位大小（字节，已对齐）
+    size_t slot_align_;                     // 槽位对齐
+    std::vector<void*> chunks_;             // 已分配的内存块
+    std::vector<void*> free_slots_;         // 空闲槽位（栈顶为下一个分配的槽位）
+    size_t live_count_ = 0;                 // 正在使用的槽位数
+
+public:
+    ComponentPool(size_t slot_size, size_t slot_align);
+    ~ComponentPool();
+
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+    ComponentPool(ComponentPool&&) = delete;
+    ComponentPool& operator=(ComponentPool&&) = delete;
+
+    /// @brief 类型 T 的组件池
+    template<typename T>
+    static ComponentPool& of() {
+        static ComponentPool pool(sizeof(T), alignof(T));
+        return pool;
+    }
+
+    void* allocate();                       // 取得一个槽位（未构造）
+    void deallocate(void* slot);            // 归还槽位（对象须已析构）
+
+    /// @brief 在池中构造一个 T
+    template<typename T, typename... Args>
+    T* construct(Args&&... args) {
+        void* slot = allocate();
+        try {
+            return ::new (slot) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(slot);
+            throw;
+        }
+    }
+
+    size_t getLiveCount() const { return live_count_; }
+    size_t getCapacity() const { return chunks_.size() * SLOTS_PER_CHUNK; }
+};
+
+/// @brief 析构组件并将其内存归还给所属的池（用作 unique_ptr 的删除器）
+struct ComponentDeleter {
+    ComponentPool* pool = nullptr;
+
+    void operator()(engine::component::Component* component) const {
+        // 池中保存的是完整对象的地址
+        void* slot = dynamic_cast<void*>(component);
+        component->~Component();
+        pool->deallocate(slot);
+    }
+};
+
+using ComponentPtr = std::unique_ptr<engine::component::Component, ComponentDeleter>;
+
+}   // namespace engine::object
@@ -8,40 +8,65 @@ namespace engine::object {
 
     GameObject::GameObject(const std::string &name, const std::string &tag): name_(name), tag_(tag)
     {
-        spdlog::trace("GameObject created: {} {}", name_, tag_);
+        spdlog::trace("GameObject created: {} {}", name_.str(), tag_.str());
+    }
+
+    GameObject::~GameObject()
+    {
+        if (archetype_storage_) archetype_storage_->erase(this);
+        if (index_) index_->erase(this);
+        if (update_scheduler_) update_scheduler_->erase(this);
+    }
+
+    void GameObject::setName(engine::utils::Symbol name)
+    {
+        const auto old_name = std::exchange(name_, name);
+        if (index_ && old_name != name) index_->rename(this, old_name);
+    }
+
+    void GameObject::setTag(engine::utils::Symbol tag)
+    {
+        const auto old_tag = std::exchange(tag_, tag);
+        if (index_ && old_tag != tag) index_->retag(this, old_tag);
     }
 
     void GameObject::update(float delta_time, engine::core::Context& context)
     {
-        for (auto &component_pair : components_)
+        // 按添加顺序、按下标遍历（组件可能在更新中添加新组件）
+        for (size_t i = 0; i < components_.size(); ++i)
         {
-            component_pair.second->update(delta_time,context);
+            components_[i]->update(delta_time,context);
         }
     }
 
     void GameObject::render(engine::core::Context& context)
     {
-        for (auto &component_pair : components_)
+        for (size_t i = 0; i < components_.size(); ++i)
         {
-            component_pair.second->render(context);
+            components_[i]->render(context);
         }
     }
 
     void GameObject::clean()
     {
-        for (auto &component_pair : components_)
+        if (archetype_storage_) archetype_storage_->erase(this);
+        if (index_) index_->erase(this);
+        if (update_scheduler_) update_scheduler_->erase(this);
+        for (auto& component : components_)
         {
-            component_pair.second->clean();
+            component->clean();
         }
         components_.clear();
-        spdlog::trace("GameObject cleaned: {} {}", name_, tag_);
+        component_slots_.fill(nullptr);
+        component_mask_ = 0;
+        spdlog::trace("GameObject cleaned: {} {}", name_.str(), tag_.str());
     }
 
     void GameObject::handleInput(engine::core::Context& context)
     {
-        for (auto &component_pair : components_)
+        for (size_t i = 0; i < components_.size(); ++i)
         {
-            component_pair.second->handleInput(context);
+            components_[i]->handleInput(context);
         }
     }
 } // namespace engine::object
\ No newline at end of file
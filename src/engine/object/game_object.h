@@ -1,38 +1,71 @@
 #pragma once
 #include "../component/component.h"
+#include "component_pool.h"
+#include "archetype_storage.h"
+#include "game_object_handle.h"
+#include "game_object_index.h"
+#include "update_scheduler.h"
+#include "../utils/symbol.h"
+#include <array>
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
-#include <typeindex>    // 用于类型索引
+#include <vector>
+#include <typeinfo>
 #include <utility>      // 用于完美转发
 #include <spdlog/spdlog.h>
 
 
 namespace engine::object {
 
-
+/**
+ * @brief 游戏对象：组件的容器
+ *
+ * 组件在按类型划分的 ComponentPool 中构造，对象按类型编号的槽位保存组件指针；
+ * 加入场景后同时登记在场景的 ArchetypeStorage 中，供系统按组件组合批量遍历。
+ */
 class GameObject final {
+    friend class ArchetypeStorage;  // 读取组件槽位并维护对象在原型中的位置
+    friend class GameObjectPool;    // 分配句柄，回收时重置对象
+    friend class GameObjectIndex;   // 维护对象在名称/标签索引中的登记
+    friend class UpdateScheduler;   // 登记对象的组件
+
 private:
-    std::string name_;
-    std::string tag_;
-    std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> components_;
+    engine::utils::Symbol name_;    // 名称（驻留字符串，比较为整数比较）
+    engine::utils::Symbol tag_;     // 标签
+    std::vector<ComponentPtr> components_;  // 按添加顺序排列的组件，更新/渲染按此顺序进行
+    std::array<engine::component::Component*, engine::component::MAX_COMPONENT_TYPES> component_slots_{};  // 按组件类型编号索引，未拥有时为 nullptr
+    std::uint32_t component_mask_ = 0;  // 第 i 位表示拥有编号为 i 的组件
     bool need_remove_ = false; // 标记是否需要删除
+    GameObjectHandle handle_;   // 在所属对象池中的句柄（不由对象池创建时无效）
+
+    ArchetypeStorage* archetype_storage_ = nullptr;     // 所在的原型存储（加入场景后设置）
+    std::uint32_t archetype_ = 0;                       // 在原型存储中的原型下标
+    std::uint32_t archetype_row_ = 0;                   // 在原型中的行号
+    GameObjectIndex* index_ = nullptr;                  // 所在的名称/标签索引（加入场景后设置）
+    UpdateScheduler* update_scheduler_ = nullptr;       // 所在的更新调度器（加入场景后设置）
 
 
 public:
 
     GameObject(const std::string& name = "", const std::string& tag = "");
+    ~GameObject();
 
     GameObject(const GameObject&) = delete;
     GameObject& operator=(const GameObject&) = delete;
     GameObject(GameObject&&) = delete;
     GameObject& operator=(GameObject&&) = delete;
 
-    void setName(const std::string& name) { name_ = name; }
-    const std::string& getName() const { return name_; }
-    void setTag(const std::string& tag) { tag_ = tag; }
-    const std::string& getTag() const { return tag_; }
+    void setName(const std::string& name) { setName(engine::utils::Symbol(name)); }
+    void setName(engine::utils::Symbol name);
+    const std::string& getName() const { return name_.str(); }
+    engine::utils::Symbol getNameSymbol() const { return name_; }
+    void setTag(const std::string& tag) { setTag(engine::utils::Symbol(tag)); }
+    void setTag(engine::utils::Symbol tag);
+    const std::string& getTag() const { return tag_.str(); }
+    engine::utils::Symbol getTagSymbol() const { return tag_; }
     void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }
     bool isNeedRemove() const { return need_remove_; }
+    GameObjectHandle getHandle() const { return handle_; }
 
     template<typename T, typename... Args>
     T* addComponent(Args&&... args) {
@@ -40,17 +73,21 @@ public:
                             /* std::is_base_of<Base, Derived>::value -- 判断 Base 类型是否是 Derived 类型的基类 */
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T must be derived from Component");
 
-        auto type_index = std::type_index(typeid(T));
+        const auto type_id = engine::component::component_type_id<T>;
         if (hasComponent<T>()){
             return getComponent<T>();
         }
 
-        auto new_component = std::make_unique<T>(std::forward<Args>(args)...);
-        T* ptr = new_component.get();
-        new_component->setOwner(this);
-        components_[type_index] = std::move(new_component);
+        auto& pool = ComponentPool::of<T>();
+        T* ptr = pool.template construct<T>(std::forward<Args>(args)...);
+        components_.push_back(ComponentPtr(ptr, ComponentDeleter{&pool}));
+        ptr->setOwner(this);
+        component_slots_[type_id] = ptr;
+        component_mask_ |= 1u << type_id;
+        if (archetype_storage_) archetype_storage_->refresh(this);
         ptr->init();
-        spdlog::debug("GameObject::addComponent: add component {} to game object {}", typeid(T).name(), name_);
+        if (update_scheduler_) update_scheduler_->add(ptr);
+        spdlog::debug("GameObject::addComponent: add component {} to game object {}", typeid(T).name(), name_.str());
         return ptr;
     }
 
@@ -58,27 +95,27 @@ public:
     T* getComponent() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T must be derived from Component");
 
-        auto type_index = std::type_index(typeid(T));
-        if (auto it = components_.find(type_index); it != components_.end()) {
-            return static_cast<T*>(it->second.get());
-        }
-        spdlog::error("GameObject::getComponent: component {} not found in game object {}", typeid(T).name(), name_);
-        return nullptr;
+        // 槽位中保存的就是 T 类型的组件（或 nullptr），直接转换即可；未拥有时返回 nullptr，由调用者处理
+        return static_cast<T*>(component_slots_[engine::component::component_type_id<T>]);
     }
 
     template<typename T>
     bool hasComponent() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T must be derived from Component");
-        return components_.contains(std::type_index(typeid(T)));
+        return (component_mask_ >> engine::component::component_type_id<T>) & 1u;
     }
 
     template<typename T>
     void removeComponent() {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T must be derived from Component");
-        auto type_index = std::type_index(typeid(T));
-        if (auto it = components_.find(type_index); it != components_.end()) {
-            it->second->clean();
-            components_.erase(it);
+        const auto type_id = engine::component::component_type_id<T>;
+        if (auto* component = component_slots_[type_id]; component) {
+            if (update_scheduler_) update_scheduler_->remove(component);
+            component->clean();
+            component_slots_[type_id] = nullptr;
+            component_mask_ &= ~(1u << type_id);
+            if (archetype_storage_) archetype_storage_->refresh(this);
+            std::erase_if(components_, [component](const auto& owned) { return owned.get() == component; });
         }
     }
 
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::object {
+
+/**
+ * @brief 游戏对象句柄：池中的槽位下标 + 世代号
+ *
+ * 对象被销毁后槽位的世代号加一，旧句柄因此失效（GameObjectPool::get() 返回 nullptr），
+ * 可以安全地长期保存，而裸指针在对象销毁后指向的可能已是复用该槽位的另一个对象。
+ */
+struct GameObjectHandle {
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+    bool operator==(const GameObjectHandle&) const = default;
+};
+
+}   // namespace engine::object
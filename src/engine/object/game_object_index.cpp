@@ -0,0 +1,77 @@
+#include "game_object_index.h"
+#include "game_object.h"
+#include <algorithm>
+
+namespace engine::object {
+
+    GameObjectIndex::~GameObjectIndex()
+    {
+        // 索引先于游戏对象销毁时，解除对象对索引的引用
+        for (auto& [name, bucket] : by_name_) {
+            for (auto* game_object : bucket) game_object->index_ = nullptr;
+        }
+        for (auto& [tag, bucket] : by_tag_) {
+            for (auto* game_object : bucket) game_object->index_ = nullptr;
+        }
+    }
+
+    void GameObjectIndex::insert(GameObject *game_object)
+    {
+        if (game_object->index_ == this) return;
+        if (game_object->index_) game_object->index_->erase(game_object);
+        add(by_name_, game_object->name_, game_object);
+        add(by_tag_, game_object->tag_, game_object);
+        game_object->index_ = this;
+    }
+
+    void GameObjectIndex::erase(GameObject *game_object)
+    {
+        if (game_object->index_ != this) return;
+        remove(by_name_, game_object->name_, game_object);
+        remove(by_tag_, game_object->tag_, game_object);
+        game_object->index_ = nullptr;
+    }
+
+    void GameObjectIndex::rename(GameObject *game_object, engine::utils::Symbol old_name)
+    {
+        remove(by_name_, old_name, game_object);
+        add(by_name_, game_object->name_, game_object);
+    }
+
+    void GameObjectIndex::retag(GameObject *game_object, engine::utils::Symbol old_tag)
+    {
+        remove(by_tag_, old_tag, game_object);
+        add(by_tag_, game_object->tag_, game_object);
+    }
+
+    GameObject *GameObjectIndex::findByName(engine::utils::Symbol name) const
+    {
+        const auto bucket = withName(name);
+        return bucket.empty() ? nullptr : bucket.front();
+    }
+
+    std::span<GameObject* const> GameObjectIndex::bucketOf(const BucketMap &map, engine::utils::Symbol key)
+    {
+        if (auto it = map.find(key); it != map.end()) return it->second;
+        return {};
+    }
+
+    void GameObjectIndex::add(BucketMap &map, engine::utils::Symbol key, GameObject *game_object)
+    {
+        if (key.empty()) return;
+        map[key].push_back(game_object);
+    }
+
+    void GameObjectIndex::remove(BucketMap &map, engine::utils::Symbol key, GameObject *game_object)
+    {
+        if (key.empty()) return;
+        auto it = map.find(key);
+        if (it == map.end()) return;
+        auto& bucket = it->second;
+        if (auto pos = std::find(bucket.begin(), bucket.end(), game_object); pos != bucket.end()) {
+            *pos = bucket.back();
+            bucket.pop_back();
+        }
+    }
+
+}   // namespace engine::object
@@ -0,0 +1,50 @@
+#pragma once
+#include "../utils/symbol.h"
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::object {
+    class GameObject;
+
+/**
+ * @brief 场景内按名称与标签索引游戏对象，由 Scene 拥有
+ *
+ * 每个名称/标签（驻留后的 Symbol）对应一个对象列表，对象加入/移出场景以及修改名称或标签时自动维护，
+ * 查找为一次散列查找，“所有带某标签的对象”直接返回已建好的列表。空名称与空标签不建立索引。
+ * 列表中的顺序不保证与加入顺序一致（移除时与末尾交换）。
+ */
+class GameObjectIndex final {
+private:
+    using Bucket = std::vector<GameObject*>;
+    using BucketMap = std::unordered_map<engine::utils::Symbol, Bucket, engine::utils::SymbolHash>;
+
+    BucketMap by_name_;     // 名称 -> 对象
+    BucketMap by_tag_;      // 标签 -> 对象
+
+public:
+    GameObjectIndex() = default;
+    ~GameObjectIndex();
+
+    GameObjectIndex(const GameObjectIndex&) = delete;
+    GameObjectIndex& operator=(const GameObjectIndex&) = delete;
+    GameObjectIndex(GameObjectIndex&&) = delete;
+    GameObjectIndex& operator=(GameObjectIndex&&) = delete;
+
+    void insert(GameObject* game_object);       // 加入索引
+    void erase(GameObject* game_object);        // 移出索引
+    void rename(GameObject* game_object, engine::utils::Symbol old_name);   // 对象的名称已修改
+    void retag(GameObject* game_object, engine::utils::Symbol old_tag);     // 对象的标签已修改
+
+    /// @brief 名称为 name 的任一对象（名称唯一时即为该对象），没有时返回 nullptr
+    GameObject* findByName(engine::utils::Symbol name) const;
+    std::span<GameObject* const> withName(engine::utils::Symbol name) const { return bucketOf(by_name_, name); }
+    std::span<GameObject* const> withTag(engine::utils::Symbol tag) const { return bucketOf(by_tag_, tag); }
+
+private:
+    static std::span<GameObject* const> bucketOf(const BucketMap& map, engine::utils::Symbol key);
+    static void add(BucketMap& map, engine::utils::Symbol key, GameObject* game_object);
+    static void remove(BucketMap& map, engine::utils::Symbol key, GameObject* game_object);
+};
+
+}   // namespace engine::object
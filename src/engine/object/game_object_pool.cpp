@@ -0,0 +1,70 @@
+#include "game_object_pool.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::object {
+
+    GameObjectPool::~GameObjectPool()
+    {
+        clear();
+        spdlog::trace("GameObjectPool destroyed, {} slots", slot_count_);
+    }
+
+    GameObject *GameObjectPool::create(const std::string &name, const std::string &tag)
+    {
+        std::uint32_t index;
+        if (!free_indices_.empty()) {
+            index = free_indices_.back();
+            free_indices_.pop_back();
+        } else {
+            if (slot_count_ == chunks_.size() * SLOTS_PER_CHUNK) {
+                chunks_.push_back(std::make_unique<Slot[]>(SLOTS_PER_CHUNK));
+            }
+            index = slot_count_++;
+        }
+
+        auto& slot = slotAt(index);
+        if (!slot.object) {
+            slot.object.emplace(name, tag);
+        } else {
+            // 复用已清理的对象，保留其组件数组的容量
+            slot.object->setName(name);
+            slot.object->setTag(tag);
+            slot.object->need_remove_ = false;
+        }
+        slot.alive = true;
+        slot.object->handle_ = GameObjectHandle{index, slot.generation};
+        ++live_count_;
+        return &*slot.object;
+    }
+
+    void GameObjectPool::destroy(GameObject *game_object)
+    {
+        const auto handle = game_object->handle_;
+        if (get(handle) != game_object) {
+            spdlog::error("GameObjectPool::destroy: game object {} does not belong to this pool or is already destroyed", game_object->getName());
+            return;
+        }
+        auto& slot = slotAt(handle.index);
+        game_object->clean();
+        game_object->handle_ = GameObjectHandle{};
+        slot.alive = false;
+        ++slot.generation;
+        free_indices_.push_back(handle.index);
+        --live_count_;
+    }
+
+    void GameObjectPool::clear()
+    {
+        for (std::uint32_t index = 0; index < slot_count_; ++index) {
+            if (slotAt(index).alive) destroy(&*slotAt(index).object);
+        }
+    }
+
+    GameObject *GameObjectPool::get(GameObjectHandle handle) const
+    {
+        if (handle.index >= slot_count_) return nullptr;
+        auto& slot = slotAt(handle.index);
+        return slot.alive && slot.generation == handle.generation ? &*slot.object : nullptr;
+    }
+
+}   // namespace engine::object
@@ -0,0 +1,61 @@
+#pragma once
+#include "game_object.h"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace engine::object {
+
+/**
+ * @brief 游戏对象池，由 Scene 拥有
+ *
+ * 对象按块分配，地址在池的生命周期内保持不变。销毁对象只清理其组件并将槽位放入空闲表，
+ * GameObject 本身（连同组件数组已分配的容量）保留下来供下一次创建复用；组件内存由 ComponentPool 复用，
+ * 因此反复生成与销毁同类对象（特效、弹道等）在稳定状态下不再需要为对象本身申请堆内存。
+ * 每个槽位带有世代号，销毁后递增，用于识别过期的 GameObjectHandle。
+ */
+class GameObjectPool final {
+private:
+    static constexpr std::uint32_t SLOTS_PER_CHUNK = 64;   // 每块的槽位数
+
+    struct Slot {
+        std::optional<GameObject> object;   // 首次使用时构造，之后一直保留
+        std::uint32_t generation = 0;       // 世代号
+        bool alive = false;                 // 是否正在使用
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> chunks_;
+    std::uint32_t slot_count_ = 0;              // 已使用过的槽位数（之后的槽位从未构造）
+    std::vector<std::uint32_t> free_indices_;   // 可复用的槽位
+    size_t live_count_ = 0;
+
+public:
+    GameObjectPool() = default;
+    ~GameObjectPool();
+
+    GameObjectPool(const GameObjectPool&) = delete;
+    GameObjectPool& operator=(const GameObjectPool&) = delete;
+    GameObjectPool(GameObjectPool&&) = delete;
+    GameObjectPool& operator=(GameObjectPool&&) = delete;
+
+    /// @brief 创建（或复用）一个游戏对象
+    GameObject* create(const std::string& name = "", const std::string& tag = "");
+    /// @brief 清理对象的组件并回收其槽位，对象的旧句柄随之失效（对象须由本池创建）
+    void destroy(GameObject* game_object);
+    /// @brief 销毁所有对象（保留槽位供复用）
+    void clear();
+
+    /// @brief 句柄对应的对象，句柄无效或已过期时返回 nullptr
+    GameObject* get(GameObjectHandle handle) const;
+    bool isAlive(GameObjectHandle handle) const { return get(handle) != nullptr; }
+
+    size_t getLiveCount() const { return live_count_; }
+    size_t getCapacity() const { return chunks_.size() * SLOTS_PER_CHUNK; }
+
+private:
+    Slot& slotAt(std::uint32_t index) const { return chunks_[index / SLOTS_PER_CHUNK][index % SLOTS_PER_CHUNK]; }
+};
+
+}   // namespace engine::object
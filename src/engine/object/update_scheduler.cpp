@@ -0,0 +1,72 @@
+#include "update_scheduler.h"
+#include "game_object.h"
+#include <algorithm>
+
+namespace engine::object {
+
+namespace {
+    constexpr std::uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+} // namespace
+
+    UpdateScheduler::~UpdateScheduler()
+    {
+        // 调度器先于游戏对象销毁时，解除对象与组件对调度器的引用
+        for (auto& entries : phases_) {
+            for (auto& entry : entries) {
+                if (!entry.component) continue;
+                entry.component->update_slot_ = INVALID_SLOT;
+                entry.owner->update_scheduler_ = nullptr;
+            }
+        }
+    }
+
+    void UpdateScheduler::insert(GameObject *game_object)
+    {
+        if (game_object->update_scheduler_ == this) return;
+        if (game_object->update_scheduler_) game_object->update_scheduler_->erase(game_object);
+        for (auto& component : game_object->components_) {
+            add(component.get());
+        }
+        game_object->update_scheduler_ = this;
+    }
+
+    void UpdateScheduler::erase(GameObject *game_object)
+    {
+        if (game_object->update_scheduler_ != this) return;
+        for (auto& component : game_object->components_) {
+            remove(component.get());
+        }
+        game_object->update_scheduler_ = nullptr;
+    }
+
+    void UpdateScheduler::add(engine::component::Component *component)
+    {
+        const auto phase = component->getUpdatePhase();
+        if (phase == engine::component::UpdatePhase::NONE || component->update_slot_ != INVALID_SLOT) return;
+        auto& entries = phases_[static_cast<size_t>(phase)];
+        component->update_slot_ = static_cast<std::uint32_t>(entries.size());
+        entries.push_back(Entry{component, component->getOwner()});
+    }
+
+    void UpdateScheduler::remove(engine::component::Component *component)
+    {
+        if (component->update_slot_ == INVALID_SLOT) return;
+        auto& entries = phases_[static_cast<size_t>(component->getUpdatePhase())];
+        entries[component->update_slot_].component = nullptr;
+        component->update_slot_ = INVALID_SLOT;
+        has_holes_ = true;
+    }
+
+    void UpdateScheduler::compact()
+    {
+        if (!has_holes_) return;
+        for (auto& entries : phases_) {
+            std::erase_if(entries, [](const Entry& entry) { return entry.component == nullptr; });
+            for (size_t i = 0; i < entries.size(); ++i) {
+                entries[i].component->update_slot_ = static_cast<std::uint32_t>(i);
+            }
+        }
+        has_holes_ = false;
+    }
+
+}   // namespace engine::object
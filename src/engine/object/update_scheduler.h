@@ -0,0 +1,88 @@
+#pragma once
+#include "../component/component.h"
+#include "../core/thread_pool.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace engine::object {
+    class GameObject;
+
+/**
+ * @brief 按更新阶段组织的组件更新列表，由 Scene 拥有
+ *
+ * 组件加入场景时按 getUpdatePhase() 登记到对应阶段的扁平列表中（NONE 不登记），场景每步按阶段顺序逐个列表更新，
+ * 同一阶段内的顺序为登记顺序，因此更新顺序是确定的，且不需要更新的组件没有任何开销。
+ * 移除组件只将其列表项置空（O(1)），在 compact() 时统一压缩。
+ */
+class UpdateScheduler final {
+private:
+    struct Entry {
+        engine::component::Component* component;   // 已移除时为 nullptr
+        GameObject* owner;
+    };
+
+    std::array<std::vector<Entry>, engine::component::UPDATE_PHASE_COUNT> phases_;
+    bool has_holes_ = false;    // 有已移除的列表项，需要压缩
+    size_t parallel_min_batch_ = 256;   // 并行更新时每块最少的组件数（组件更新很轻，太小的块分发开销超过收益）
+
+public:
+    UpdateScheduler() = default;
+    ~UpdateScheduler();
+
+    UpdateScheduler(const UpdateScheduler&) = delete;
+    UpdateScheduler& operator=(const UpdateScheduler&) = delete;
+    UpdateScheduler(UpdateScheduler&&) = delete;
+    UpdateScheduler& operator=(UpdateScheduler&&) = delete;
+
+    void insert(GameObject* game_object);                    // 登记对象的所有组件，之后对象增删组件时自动维护
+    void erase(GameObject* game_object);                     // 注销对象的所有组件
+    void add(engine::component::Component* component);      // 登记组件（所属对象已设置）
+    void remove(engine::component::Component* component);   // 注销组件
+    void compact();                                          // 压缩已移除的列表项（保持顺序）
+
+    /**
+     * @brief 更新一个阶段的所有组件
+     *
+     * @param phase 阶段
+     * @param delta_time 时间步长
+     * @param context 引擎上下文
+     * @param time_scale 按所属对象返回本步的时间倍率，返回 0 表示本步跳过该对象（如待删除或被冻结的对象）
+     */
+    template<typename TimeScaleFunc>
+    void update(engine::component::UpdatePhase phase, float delta_time, engine::core::Context& context, TimeScaleFunc&& time_scale) {
+        auto& entries = phases_[static_cast<size_t>(phase)];
+        // 按下标遍历：更新中可能登记新的组件
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const auto entry = entries[i];
+            if (!entry.component) continue;
+            const float scale = time_scale(*entry.owner);
+            if (scale > 0.0f) entry.component->update(delta_time * scale, context);
+        }
+    }
+
+    /**
+     * @brief 使用线程池并行更新一个阶段的所有组件，列表被切分为连续的块，全部完成后返回
+     *
+     * 只适用于组件的更新只修改自身与所属对象的阶段（如动画），更新中不可登记或注销组件，也不可访问非线程安全的全局模块。
+     * 各组件互不依赖，因此结果与串行更新相同。
+     */
+    template<typename TimeScaleFunc>
+    void updateParallel(engine::component::UpdatePhase phase, float delta_time, engine::core::Context& context,
+                        TimeScaleFunc&& time_scale, engine::core::ThreadPool& thread_pool) {
+        const auto& entries = phases_[static_cast<size_t>(phase)];
+        thread_pool.parallelFor(entries.size(), parallel_min_batch_, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                const auto entry = entries[i];
+                if (!entry.component) continue;
+                const float scale = time_scale(*entry.owner);
+                if (scale > 0.0f) entry.component->update(delta_time * scale, context);
+            }
+        });
+    }
+
+    void setParallelMinBatch(size_t min_batch) { parallel_min_batch_ = min_batch; }
+    size_t getCount(engine::component::UpdatePhase phase) const { return phases_[static_cast<size_t>(phase)].size(); }
+};
+
+}   // namespace engine::object
@@ -0,0 +1,107 @@
+#include "body_storage.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+    namespace {
+        // 将末尾元素移动到 index 处并弹出末尾
+        template <typename T>
+        void swapRemove(std::vector<T>& array, size_t index) {
+            array[index] = array.back();
+            array.pop_back();
+        }
+    }
+
+    BodyHandle BodyStorage::create(engine::component::PhysicsComponent *component, bool use_gravity, float mass)
+    {
+        BodyHandle handle;
+        if (!free_handles_.empty()) {
+            handle = free_handles_.back();
+            free_handles_.pop_back();
+        } else if (dense_of_.size() < MAX_BODY_SLOTS) {
+            handle = static_cast<BodyHandle>(dense_of_.size());
+            dense_of_.push_back(INVALID_BODY_HANDLE);
+        } else {
+            spdlog::error("BodyStorage::create() - too many bodies (max {})", MAX_BODY_SLOTS);
+            return INVALID_BODY_HANDLE;
+        }
+
+        const auto index = handle_of_.size();
+        dense_of_[handle & BODY_SLOT_MASK] = static_cast<std::uint32_t>(index);
+        handle_of_.push_back(handle);
+
+        position_.emplace_back(0.0f, 0.0f);
+        velocity_.emplace_back(0.0f, 0.0f);
+        force_.emplace_back(0.0f, 0.0f);
+        aabb_offset_.emplace_back(0.0f, 0.0f);
+        aabb_size_.emplace_back(0.0f, 0.0f);
+        mass_.push_back(1.0f);
+        inv_mass_.push_back(1.0f);
+        flags_.push_back(static_cast<std::uint16_t>(BodyFlags::ENABLED | (use_gravity ? BodyFlags::USE_GRAVITY : 0u)));
+        collision_layer_.push_back(CollisionLayer::DEFAULT);
+        collision_mask_.push_back(CollisionLayer::ALL);
+        type_.push_back(BodyType::DYNAMIC);
+        shape_.push_back(ColliderType::NONE);
+        sleep_timer_.push_back(0.0f);
+        tile_triggers_.push_back(0);
+        carrier_.push_back(INVALID_BODY_HANDLE);
+        carry_offset_.emplace_back(0.0f, 0.0f);
+        step_scale_.push_back(1.0f);
+        always_active_.push_back(0);
+        component_.push_back(component);
+        transform_.push_back(nullptr);
+        collider_.push_back(nullptr);
+
+        setMass(index, mass);
+        return handle;
+    }
+
+    void BodyStorage::destroy(BodyHandle handle)
+    {
+        if (!isValid(handle)) {
+            spdlog::warn("BodyStorage::destroy() - invalid body handle {}", handle);
+            return;
+        }
+
+        const auto index = indexOf(handle);
+        const auto moved_handle = handle_of_.back();
+
+        swapRemove(position_, index);
+        swapRemove(velocity_, index);
+        swapRemove(force_, index);
+        swapRemove(aabb_offset_, index);
+        swapRemove(aabb_size_, index);
+        swapRemove(mass_, index);
+        swapRemove(inv_mass_, index);
+        swapRemove(flags_, index);
+        swapRemove(collision_layer_, index);
+        swapRemove(collision_mask_, index);
+        swapRemove(type_, index);
+        swapRemove(shape_, index);
+        swapRemove(sleep_timer_, index);
+        swapRemove(tile_triggers_, index);
+        swapRemove(carrier_, index);
+        swapRemove(carry_offset_, index);
+        swapRemove(step_scale_, index);
+        swapRemove(always_active_, index);
+        swapRemove(component_, index);
+        swapRemove(transform_, index);
+        swapRemove(collider_, index);
+        swapRemove(handle_of_, index);
+
+        // 被删除的若不是末尾刚体，则末尾刚体移动到了 index
+        if (moved_handle != handle) {
+            dense_of_[moved_handle & BODY_SLOT_MASK] = index;
+        }
+        dense_of_[handle & BODY_SLOT_MASK] = INVALID_BODY_HANDLE;
+        // 复用槽位时代数加一（溢出后从 0 重新开始），旧句柄随之失效
+        free_handles_.push_back(handle + (1u << BODY_SLOT_BITS));
+    }
+
+    void BodyStorage::setMass(size_t index, float mass)
+    {
+        mass_[index] = (mass >= 0.0f) ? mass : 1.0f;
+        inv_mass_[index] = mass_[index] > 0.0f ? 1.0f / mass_[index] : 0.0f;
+    }
+
+}   // namespace engine::physics
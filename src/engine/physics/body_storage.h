@@ -0,0 +1,149 @@
+#pragma once
+#include "collision_layer.h"
+#include "tile_trigger.h"
+#include "collider.h"
+#include <glm/vec2.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace engine::component {
+    class PhysicsComponent;
+    class TransformComponent;
+    class ColliderComponent;
+}
+
+namespace engine::physics {
+
+/**
+ * @brief 刚体句柄（稳定编号，刚体被移除前不会改变；稠密下标则会因交换删除而变化）
+ *
+ * 低 BODY_SLOT_BITS 位为槽位，高位为代数：槽位被复用时代数加一，因此刚体删除后残留的旧句柄（如加速结构、
+ * 承载关系中保存的）不会指向占用同一槽位的新刚体，isValid() 会拒绝它。打包为 32 位是为了仍能作为网格代理编号与碰撞对的键。
+ */
+using BodyHandle = std::uint32_t;
+inline constexpr BodyHandle INVALID_BODY_HANDLE = 0xFFFFFFFFu;
+inline constexpr std::uint32_t BODY_SLOT_BITS = 20;
+inline constexpr std::uint32_t BODY_SLOT_MASK = (1u << BODY_SLOT_BITS) - 1u;
+inline constexpr std::uint32_t MAX_BODY_SLOTS = BODY_SLOT_MASK;     // 槽位全 1 保留给 INVALID_BODY_HANDLE
+
+/// @brief 刚体类型
+enum class BodyType : std::uint8_t {
+    STATIC,         // 静态：从不移动，不积分、不与瓦片碰撞，存放于单独的静态加速结构中
+    KINEMATIC,      // 运动学：只按速度移动，不受力与重力影响，不与瓦片碰撞，也不会被 SOLID 推挤
+    DYNAMIC,        // 动态：完整模拟（默认），静止一段时间后进入休眠
+};
+
+/// @brief 刚体标志位
+struct BodyFlags {
+    static constexpr std::uint16_t ENABLED          = 1u << 0;   // 是否启用物理
+    static constexpr std::uint16_t USE_GRAVITY      = 1u << 1;   // 是否受重力影响
+    static constexpr std::uint16_t ATTACHED         = 1u << 2;   // 已绑定 TransformComponent（init 成功）
+    static constexpr std::uint16_t HAS_COLLIDER     = 1u << 3;   // 拥有碰撞器（每帧刷新）
+    static constexpr std::uint16_t COLLIDER_ACTIVE  = 1u << 4;   // 碰撞器已激活（每帧刷新）
+    static constexpr std::uint16_t TRIGGER          = 1u << 5;   // 碰撞器为触发器（每帧刷新）
+    static constexpr std::uint16_t BULLET           = 1u << 6;   // 高速物体，与瓦片层进行连续碰撞检测
+    static constexpr std::uint16_t CARRIER_CONTACT  = 1u << 7;   // 本步站在承载体上（窄阶段中设置，更新承载关系后清除）
+
+    // 碰撞状态（每帧开始时对启用的刚体清空）
+    static constexpr std::uint16_t COLLIDED_BELOW   = 1u << 8;
+    static constexpr std::uint16_t COLLIDED_ABOVE   = 1u << 9;
+    static constexpr std::uint16_t COLLIDED_LEFT    = 1u << 10;
+    static constexpr std::uint16_t COLLIDED_RIGHT   = 1u << 11;
+    static constexpr std::uint16_t COLLIDED_LADDER  = 1u << 12;
+    static constexpr std::uint16_t ON_TOP_LADDER    = 1u << 13;
+    static constexpr std::uint16_t SLEEPING         = 1u << 14;  // 休眠中（跳过积分与位移，碰撞状态保持不变）
+    static constexpr std::uint16_t DORMANT          = 1u << 15;  // 本步因所在区块远离相机而不模拟（与休眠相同地跳过，但保留速度）
+    static constexpr std::uint16_t COLLISION_STATE  = COLLIDED_BELOW | COLLIDED_ABOVE | COLLIDED_LEFT |
+                                                      COLLIDED_RIGHT | COLLIDED_LADDER | ON_TOP_LADDER;
+
+    /// @brief 参与模拟（积分、瓦片碰撞）所需的标志
+    static constexpr std::uint16_t SIMULATED        = ENABLED | ATTACHED;
+    /// @brief 本步不移动（休眠或冻结）的标志
+    static constexpr std::uint16_t INACTIVE         = SLEEPING | DORMANT;
+};
+
+/**
+ * @brief 刚体数据的结构数组（SoA）存储，由 PhysicsEngine 拥有
+ *
+ * 每个属性一条连续数组，下标为稠密下标（0 ~ size()-1），积分等逐刚体的计算可以顺序遍历内存并被编译器向量化。
+ * 删除采用“与末尾交换后弹出”，因此外部只保存句柄，通过 indexOf() 换算为当前稠密下标。
+ * 位置在一帧开始时从 TransformComponent 收集，位移处理后再写回（TransformComponent 仍是位置的权威来源）。
+ */
+class BodyStorage final {
+public:
+    // --- 紧凑数组（按稠密下标访问）---
+    std::vector<glm::vec2> position_;       // 变换位置（每帧从 TransformComponent 收集）
+    std::vector<glm::vec2> velocity_;       // 速度
+    std::vector<glm::vec2> force_;          // 当前帧受力
+    std::vector<glm::vec2> aabb_offset_;    // 包围盒左上角相对于变换原点的偏移（每帧刷新）
+    std::vector<glm::vec2> aabb_size_;      // 包围盒尺寸（已乘缩放，每帧刷新）
+    std::vector<float> mass_;               // 质量
+    std::vector<float> inv_mass_;           // 质量的倒数（质量为0时为0，即不受力影响）
+    std::vector<std::uint16_t> flags_;      // 标志位，见 BodyFlags
+    std::vector<CollisionMask> collision_layer_;    // 碰撞器所属层（每帧刷新）
+    std::vector<CollisionMask> collision_mask_;     // 碰撞器检测掩码（每帧刷新）
+    std::vector<BodyType> type_;            // 刚体类型
+    std::vector<ColliderType> shape_;       // 碰撞器形状（每帧刷新），窄阶段据此查表分派
+    std::vector<float> sleep_timer_;        // 动态刚体持续静止的时间（秒），达到阈值后休眠
+    std::vector<TileTypeMask> tile_triggers_;    // 上一步接触到的触发瓦片类型（用于生成进入/停留/离开事件）
+    std::vector<BodyHandle> carrier_;       // 承载该刚体的运动学刚体（站在移动平台上时），否则为 INVALID_BODY_HANDLE
+    std::vector<glm::vec2> carry_offset_;   // 本步随承载体移动的位移（与自身位移一并进行瓦片碰撞检测后清零）
+    std::vector<float> step_scale_;         // 本步的时间倍率（降频模拟的刚体在轮到模拟的一步按累计的时间推进，否则为 1）
+    std::vector<std::uint8_t> always_active_;   // 不受区块模拟级别与离开世界策略影响（如玩家）
+
+    // --- 所属组件（非拥有指针）---
+    std::vector<engine::component::PhysicsComponent*> component_;
+    std::vector<engine::component::TransformComponent*> transform_;
+    std::vector<engine::component::ColliderComponent*> collider_;
+
+private:
+    std::vector<std::uint32_t> dense_of_;   // 槽位 -> 稠密下标
+    std::vector<BodyHandle> handle_of_;     // 稠密下标 -> 句柄
+    std::vector<BodyHandle> free_handles_;  // 可复用的句柄（代数已加一）
+
+public:
+    BodyStorage() = default;
+
+    BodyStorage(const BodyStorage&) = delete;
+    BodyStorage& operator=(const BodyStorage&) = delete;
+    BodyStorage(BodyStorage&&) = delete;
+    BodyStorage& operator=(BodyStorage&&) = delete;
+
+    /**
+     * @brief 创建刚体
+     *
+     * @param component 所属的物理组件
+     * @param use_gravity 是否受重力影响
+     * @param mass 质量
+     * @return BodyHandle 刚体句柄（槽位用尽时为 INVALID_BODY_HANDLE）
+     */
+    BodyHandle create(engine::component::PhysicsComponent* component, bool use_gravity, float mass);
+
+    /// @brief 删除刚体（末尾刚体会被移动到被删除的位置）
+    void destroy(BodyHandle handle);
+
+    /// @brief 句柄是否指向现存的刚体（槽位在用且代数一致）
+    bool isValid(BodyHandle handle) const {
+        const auto slot = handle & BODY_SLOT_MASK;
+        return slot < dense_of_.size() && dense_of_[slot] != INVALID_BODY_HANDLE && handle_of_[dense_of_[slot]] == handle;
+    }
+    std::uint32_t indexOf(BodyHandle handle) const { return dense_of_[handle & BODY_SLOT_MASK]; }
+    BodyHandle handleOf(size_t index) const { return handle_of_[index]; }
+    size_t size() const { return handle_of_.size(); }
+    bool empty() const { return handle_of_.empty(); }
+
+    void setMass(size_t index, float mass);
+
+    /// @brief 唤醒刚体（清除休眠标志并重置静止计时）
+    void wake(size_t index) {
+        flags_[index] = static_cast<std::uint16_t>(flags_[index] & ~BodyFlags::SLEEPING);
+        sleep_timer_[index] = 0.0f;
+    }
+
+    bool hasFlag(size_t index, std::uint16_t flag) const { return (flags_[index] & flag) != 0; }
+    void setFlag(size_t index, std::uint16_t flag, bool value) {
+        flags_[index] = static_cast<std::uint16_t>(value ? (flags_[index] | flag) : (flags_[index] & ~flag));
+    }
+};
+
+}   // namespace engine::physics
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::physics {
+
+/**
+ * @brief 物体间碰撞检测的宽阶段（broadphase）算法
+ */
+enum class BroadphaseType {
+    BRUTE_FORCE,        // 暴力两两检测 O(n²)，用于对照验证
+    UNIFORM_GRID,       // 均匀网格（空间哈希）
+    SWEEP_AND_PRUNE,    // 沿 X 轴排序扫描
+};
+
+// 候选对编码为 64 位整数（高32位为较小的编号），按数值排序即为 (a, b) 字典序
+inline std::uint64_t makePairKey(std::uint32_t a, std::uint32_t b) {
+    return (static_cast<std::uint64_t>(a) << 32) | static_cast<std::uint64_t>(b);
+}
+inline std::uint32_t pairFirst(std::uint64_t key) { return static_cast<std::uint32_t>(key >> 32); }
+inline std::uint32_t pairSecond(std::uint64_t key) { return static_cast<std::uint32_t>(key & 0xFFFFFFFFu); }
+
+}   // namespace engine::physics
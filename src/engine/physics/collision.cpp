@@ -2,51 +2,132 @@
 #include "collision.h"
 #include "../component/collider_component.h"
 #include "../component/transform_component.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define ENGINE_AABB_BATCH_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ENGINE_AABB_BATCH_SSE
+#endif
 
 namespace engine::physics::collision {
 
-    bool checkCollision(component::ColliderComponent& a, component::ColliderComponent& b)
-    {
-        auto a_collider = a.getCollider();
-        auto b_collider = b.getCollider();
-        auto a_transform = a.getTransform();
-        auto b_transform = b.getTransform();
+    namespace {
+        using ContactFunction = bool (*)(const Shape&, const Shape&, Contact&);
 
-        auto a_size = a_collider->getAABBSize() * a_transform->getScale();
-        auto b_size = b_collider->getAABBSize() * b_transform->getScale();
-        auto a_pos = a_transform->getPosition() + a.getOffset();
-        auto b_pos = b_transform->getPosition() + b.getOffset();
+        glm::vec2 centerOf(const Shape& shape) { return shape.bounds.position + shape.bounds.size / 2.0f; }
+        float radiusOf(const Shape& shape) { return 0.5f * shape.bounds.size.x; }
 
-        if (!checkAABBOverlap(a_pos, a_size, b_pos, b_size)){
-            return false;
-        }
+        bool contactNone(const Shape&, const Shape&, Contact&) { return false; }
 
-        // 如果最小包围盒有碰撞，再进行更详细的碰撞检测
-        if (a_collider->getType() == ColliderType::AABB && b_collider->getType() == ColliderType::AABB){
+        bool contactAABBAABB(const Shape& a, const Shape& b, Contact& out)
+        {
+            // 包围盒已确认重叠，沿重叠较少的轴分离
+            const auto& overlap = out.overlap;
+            const auto a_center = centerOf(a);
+            const auto b_center = centerOf(b);
+            if (overlap.x < overlap.y) {
+                out.normal = {a_center.x < b_center.x ? 1.0f : -1.0f, 0.0f};
+                out.penetration = overlap.x;
+            } else {
+                out.normal = {0.0f, a_center.y < b_center.y ? 1.0f : -1.0f};
+                out.penetration = overlap.y;
+            }
             return true;
         }
-        else if (a_collider->getType() == ColliderType::CIRCLE && b_collider->getType() == ColliderType::CIRCLE){
-            auto a_center = a_pos + 0.5f * a_size;
-            auto b_center = b_pos + 0.5f * b_size;
-            auto a_radius = 0.5f * a_size.x;
-            auto b_radius = 0.5f * b_size.x;
-            return checkCircleOverlap(a_center, a_radius, b_center, b_radius);
 
+        bool contactCircleCircle(const Shape& a, const Shape& b, Contact& out)
+        {
+            const auto a_center = centerOf(a);
+            const auto b_center = centerOf(b);
+            const float radius_sum = radiusOf(a) + radiusOf(b);
+            if (!checkCircleOverlap(a_center, radiusOf(a), b_center, radiusOf(b))) return false;
+
+            const auto delta = b_center - a_center;
+            const float distance = glm::length(delta);
+            out.normal = distance > 0.0f ? delta / distance : glm::vec2(0.0f, 1.0f);   // 圆心重合时取向下
+            out.penetration = radius_sum - distance;
+            return true;
         }
-        else if (a_collider->getType() == ColliderType::AABB && b_collider->getType() == ColliderType::CIRCLE){
-            auto b_center = b_pos + 0.5f * b_size;
-            auto b_radius = 0.5f * b_size.x;
-            auto nearest_point = glm::clamp(b_center,a_pos, a_pos + a_size);    // 获取 Rect 上的最近点
-            return checkPointInCircle(nearest_point, b_center, b_radius);
+
+        bool contactAABBCircle(const Shape& a, const Shape& b, Contact& out)
+        {
+            const auto box_min = a.bounds.position;
+            const auto box_max = a.bounds.position + a.bounds.size;
+            const auto center = centerOf(b);
+            const float radius = radiusOf(b);
+            const auto nearest_point = glm::clamp(center, box_min, box_max);    // 获取 Rect 上的最近点
+            if (!checkPointInCircle(nearest_point, center, radius)) return false;
+
+            const auto delta = center - nearest_point;
+            const float distance = glm::length(delta);
+            if (distance > 0.0f) {
+                out.normal = delta / distance;
+                out.penetration = radius - distance;
+                return true;
+            }
+            // 圆心在矩形内：从距离最近的边推出
+            const glm::vec2 to_min = center - box_min;
+            const glm::vec2 to_max = box_max - center;
+            const glm::vec2 nearest = glm::min(to_min, to_max);
+            if (nearest.x < nearest.y) {
+                out.normal = {to_min.x < to_max.x ? -1.0f : 1.0f, 0.0f};
+                out.penetration = radius + nearest.x;
+            } else {
+                out.normal = {0.0f, to_min.y < to_max.y ? -1.0f : 1.0f};
+                out.penetration = radius + nearest.y;
+            }
+            return true;
         }
-        else if (a_collider->getType() == ColliderType::CIRCLE && b_collider->getType() == ColliderType::AABB){
-            auto a_center = a_pos + 0.5f * a_size;
-            auto a_radius = 0.5f * a_size.x;
-            auto nearest_point = glm::clamp(a_center,b_pos, b_pos + b_size);
-            return checkPointInCircle(nearest_point, a_center, a_radius);
+
+        template <ContactFunction Function>
+        bool contactSwapped(const Shape& a, const Shape& b, Contact& out)
+        {
+            if (!Function(b, a, out)) return false;
+            out.normal = -out.normal;
+            return true;
         }
-        // more...
-        return false;
+
+        constexpr size_t SHAPE_TYPE_COUNT = static_cast<size_t>(ColliderType::CIRCLE) + 1;
+
+        // 分派表：[a 的类型][b 的类型]，与 ColliderType 的取值顺序一致（NONE、AABB、CIRCLE）
+        constexpr std::array<std::array<ContactFunction, SHAPE_TYPE_COUNT>, SHAPE_TYPE_COUNT> CONTACT_TABLE = {{
+            {{contactNone, contactNone, contactNone}},
+            {{contactNone, contactAABBAABB, contactAABBCircle}},
+            {{contactNone, contactSwapped<contactAABBCircle>, contactCircleCircle}},
+        }};
+    }
+
+    Shape makeShape(const component::ColliderComponent &collider)
+    {
+        const auto* shape_collider = collider.getCollider();
+        const auto* transform = collider.getTransform();
+        if (!shape_collider || !transform) return {};
+        return {shape_collider->getType(),
+                {transform->getPosition() + collider.getOffset(), shape_collider->getAABBSize() * transform->getScale()}};
+    }
+
+    bool computeContact(const Shape &a, const Shape &b, Contact &out_contact)
+    {
+        const auto a_index = static_cast<size_t>(a.type);
+        const auto b_index = static_cast<size_t>(b.type);
+        if (a_index >= SHAPE_TYPE_COUNT || b_index >= SHAPE_TYPE_COUNT) return false;
+        if (!checkRectOverlap(a.bounds, b.bounds)) return false;
+
+        // 包围盒重叠量（各形状共用，也用于判断重叠是否可以忽略）
+        out_contact.overlap = (a.bounds.size / 2.0f + b.bounds.size / 2.0f) - glm::abs(centerOf(a) - centerOf(b));
+        return CONTACT_TABLE[a_index][b_index](a, b, out_contact);
+    }
+
+    bool checkCollision(component::ColliderComponent& a, component::ColliderComponent& b)
+    {
+        Contact contact;
+        return computeContact(makeShape(a), makeShape(b), contact);
     }
 
     bool checkCircleOverlap(const glm::vec2 &a_center, float a_radius, const glm::vec2 &b_center, float b_radius)
@@ -74,4 +155,164 @@ namespace engine::physics::collision {
         return (glm::length(point - center) < radius);
     }
 
+    bool intersectRayAABB(const glm::vec2 &origin, const glm::vec2 &direction, float max_distance,
+                          const engine::utils::Rect &box, float &out_distance, glm::vec2 &out_normal)
+    {
+        const glm::vec2 box_min = box.position;
+        const glm::vec2 box_max = box.position + box.size;
+        float t_near = 0.0f;
+        float t_far = max_distance;
+        glm::vec2 normal = {0.0f, 0.0f};
+
+        for (int axis = 0; axis < 2; ++axis) {
+            if (direction[axis] == 0.0f) {
+                // 与该轴平行：起点必须在 slab 内
+                if (origin[axis] < box_min[axis] || origin[axis] > box_max[axis]) return false;
+                continue;
+            }
+            const float inv = 1.0f / direction[axis];
+            float t0 = (box_min[axis] - origin[axis]) * inv;
+            float t1 = (box_max[axis] - origin[axis]) * inv;
+            float sign = -1.0f;         // 从 min 面进入时法线指向负方向
+            if (t0 > t1) {
+                std::swap(t0, t1);
+                sign = 1.0f;
+            }
+            if (t0 > t_near) {
+                t_near = t0;
+                normal = {0.0f, 0.0f};
+                normal[axis] = sign;
+            }
+            t_far = std::min(t_far, t1);
+            if (t_near > t_far) return false;
+        }
+
+        out_distance = t_near;
+        out_normal = normal;
+        return true;
+    }
+
+    bool intersectRayCircle(const glm::vec2 &origin, const glm::vec2 &direction, float max_distance,
+                            const glm::vec2 &center, float radius, float &out_distance, glm::vec2 &out_normal)
+    {
+        const glm::vec2 to_origin = origin - center;
+        const float c = glm::dot(to_origin, to_origin) - radius * radius;
+        if (c <= 0.0f) {    // 起点在圆内
+            out_distance = 0.0f;
+            out_normal = {0.0f, 0.0f};
+            return true;
+        }
+        const float b = glm::dot(to_origin, direction);
+        if (b > 0.0f) return false;     // 起点在圆外且背离圆心
+        const float discriminant = b * b - c;
+        if (discriminant < 0.0f) return false;
+        const float t = -b - std::sqrt(discriminant);
+        if (t > max_distance) return false;
+        out_distance = t;
+        out_normal = (origin + direction * t - center) / radius;
+        return true;
+    }
+
+    void PackedAABBs::clear()
+    {
+        min_x.clear();
+        min_y.clear();
+        max_x.clear();
+        max_y.clear();
+    }
+
+    void PackedAABBs::resize(size_t count)
+    {
+        min_x.resize(count);
+        min_y.resize(count);
+        max_x.resize(count);
+        max_y.resize(count);
+    }
+
+    void PackedAABBs::push_back(const glm::vec2 &min, const glm::vec2 &max)
+    {
+        min_x.push_back(min.x);
+        min_y.push_back(min.y);
+        max_x.push_back(max.x);
+        max_y.push_back(max.y);
+    }
+
+    void PackedAABBs::set(size_t index, const glm::vec2 &min, const glm::vec2 &max)
+    {
+        min_x[index] = min.x;
+        min_y[index] = min.y;
+        max_x[index] = max.x;
+        max_y[index] = max.y;
+    }
+
+    std::uint64_t checkAABBOverlapBatch(const glm::vec2 &query_min, const glm::vec2 &query_max,
+                                        const PackedAABBs &boxes, size_t first, size_t count)
+    {
+        count = std::min<size_t>(count, 64);
+        const float* min_x = boxes.min_x.data() + first;
+        const float* min_y = boxes.min_y.data() + first;
+        const float* max_x = boxes.max_x.data() + first;
+        const float* max_y = boxes.max_y.data() + first;
+
+        std::uint64_t mask = 0;
+        size_t k = 0;
+
+        // 重叠条件：box.min < query.max 且 box.max > query.min（两个轴），与 checkAABBOverlap 的否定形式等价
+#ifdef ENGINE_AABB_BATCH_AVX2
+        {
+            const __m256 q_min_x = _mm256_set1_ps(query_min.x);
+            const __m256 q_min_y = _mm256_set1_ps(query_min.y);
+            const __m256 q_max_x = _mm256_set1_ps(query_max.x);
+            const __m256 q_max_y = _mm256_set1_ps(query_max.y);
+            for (; k + 8 <= count; k += 8) {
+                const __m256 overlap_x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(min_x + k), q_max_x, _CMP_LT_OQ),
+                                                       _mm256_cmp_ps(_mm256_loadu_ps(max_x + k), q_min_x, _CMP_GT_OQ));
+                const __m256 overlap_y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(min_y + k), q_max_y, _CMP_LT_OQ),
+                                                       _mm256_cmp_ps(_mm256_loadu_ps(max_y + k), q_min_y, _CMP_GT_OQ));
+                const auto bits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(overlap_x, overlap_y)));
+                mask |= static_cast<std::uint64_t>(bits) << k;
+            }
+        }
+#endif
+#ifdef ENGINE_AABB_BATCH_SSE
+        {
+            const __m128 q_min_x = _mm_set1_ps(query_min.x);
+            const __m128 q_min_y = _mm_set1_ps(query_min.y);
+            const __m128 q_max_x = _mm_set1_ps(query_max.x);
+            const __m128 q_max_y = _mm_set1_ps(query_max.y);
+            for (; k + 4 <= count; k += 4) {
+                const __m128 overlap_x = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(min_x + k), q_max_x),
+                                                    _mm_cmpgt_ps(_mm_loadu_ps(max_x + k), q_min_x));
+                const __m128 overlap_y = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(min_y + k), q_max_y),
+                                                    _mm_cmpgt_ps(_mm_loadu_ps(max_y + k), q_min_y));
+                const auto bits = static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(overlap_x, overlap_y)));
+                mask |= static_cast<std::uint64_t>(bits) << k;
+            }
+        }
+#endif
+        // 标量实现（以及 SIMD 处理后剩余的部分）
+        for (; k < count; ++k) {
+            const bool hit = min_x[k] < query_max.x && max_x[k] > query_min.x &&
+                             min_y[k] < query_max.y && max_y[k] > query_min.y;
+            mask |= static_cast<std::uint64_t>(hit) << k;
+        }
+        return mask;
+    }
+
+    std::uint64_t checkAABBOverlapBatch(const engine::utils::Rect &query, const PackedAABBs &boxes, size_t first, size_t count)
+    {
+        return checkAABBOverlapBatch(query.position, query.position + query.size, boxes, first, count);
+    }
+
+    const char *getAABBBatchBackend()
+    {
+#if defined(ENGINE_AABB_BATCH_AVX2)
+        return "AVX2";
+#elif defined(ENGINE_AABB_BATCH_SSE)
+        return "SSE";
+#else
+        return "scalar";
+#endif
+    }
+
 } // namespace engine::physics
\ No newline at end of file
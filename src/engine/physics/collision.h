@@ -1,5 +1,8 @@
 #pragma once
+#include "collider.h"
 #include "../utils/math.h"
+#include <vector>
+#include <cstdint>
 
 namespace engine::component {
     class ColliderComponent;
@@ -7,6 +10,39 @@ namespace engine::component {
 
 namespace engine::physics::collision {
 
+/**
+ * @brief 窄阶段使用的形状（世界坐标）
+ *
+ * 圆形的直径为包围盒宽度，圆心为包围盒中心。
+ */
+struct Shape {
+    ColliderType type = ColliderType::NONE;
+    engine::utils::Rect bounds;     // 包围盒
+};
+
+/**
+ * @brief 两个形状的接触信息
+ */
+struct Contact {
+    glm::vec2 normal = {0.0f, 0.0f};    // 接触法线（单位向量，由 a 指向 b）
+    float penetration = 0.0f;           // 沿法线的穿透深度，a 沿 -normal 移动该距离即可分离
+    glm::vec2 overlap = {0.0f, 0.0f};   // 两个包围盒在各轴上的重叠量
+
+    /// @brief 交换 a、b 后的接触信息
+    Contact flipped() const { return {-normal, penetration, overlap}; }
+};
+
+/// @brief 根据碰撞器组件生成世界坐标下的形状
+Shape makeShape(const component::ColliderComponent& collider);
+
+/**
+ * @brief 窄阶段：按形状类型查表分派（AABB-AABB、圆-圆、AABB-圆），计算接触信息
+ *
+ * 先以包围盒快速剔除，分派表在编译期生成，不经过虚函数。
+ * @return bool 是否接触（仅接触边界不算）
+ */
+bool computeContact(const Shape& a, const Shape& b, Contact& out_contact);
+
 bool checkCollision(component::ColliderComponent& a, component::ColliderComponent& b);
 
 bool checkCircleOverlap(const glm::vec2& a_center, float a_radius, const glm::vec2& b_center, float b_radius);
@@ -17,6 +53,61 @@ bool checkRectOverlap(const engine::utils::Rect& a, const engine::utils::Rect& b
 
 bool checkPointInCircle(const glm::vec2& point, const glm::vec2& center, float radius);
 
+/**
+ * @brief 射线与包围盒求交（slab 法）
+ *
+ * @param origin 射线起点
+ * @param direction 单位方向向量
+ * @param max_distance 最大检测距离
+ * @param box 包围盒
+ * @param out_distance 输出：命中距离（起点在盒内时为 0）
+ * @param out_normal 输出：命中面的法线（起点在盒内时为零向量）
+ * @return bool 是否在 [0, max_distance] 内命中
+ */
+bool intersectRayAABB(const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                      const engine::utils::Rect& box, float& out_distance, glm::vec2& out_normal);
+
+/// @brief 射线与圆求交，参数含义同 intersectRayAABB
+bool intersectRayCircle(const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                        const glm::vec2& center, float radius, float& out_distance, glm::vec2& out_normal);
+
+/**
+ * @brief 打包的包围盒数组（结构数组），供批量检测使用
+ *
+ * 按 min/max 存储边界，相同下标的四个元素组成一个包围盒。
+ */
+struct PackedAABBs {
+    std::vector<float> min_x;
+    std::vector<float> min_y;
+    std::vector<float> max_x;
+    std::vector<float> max_y;
+
+    size_t size() const { return min_x.size(); }
+    void clear();
+    void resize(size_t count);
+    void push_back(const glm::vec2& min, const glm::vec2& max);
+    void set(size_t index, const glm::vec2& min, const glm::vec2& max);
+};
+
+/**
+ * @brief 批量检测：一个查询包围盒与 boxes 中下标 [first, first + count) 的包围盒是否重叠
+ *
+ * 判定与 checkAABBOverlap 一致（严格重叠，仅接触不算）。根据编译选项使用 AVX2（8 路）、SSE（4 路）或标量实现。
+ * @param query_min 查询包围盒左上角
+ * @param query_max 查询包围盒右下角
+ * @param boxes 打包的包围盒数组
+ * @param first 起始下标
+ * @param count 检测数量（最多 64，超出部分忽略）
+ * @return std::uint64_t 命中位掩码，第 k 位对应 boxes 中的 first + k
+ */
+std::uint64_t checkAABBOverlapBatch(const glm::vec2& query_min, const glm::vec2& query_max,
+                                    const PackedAABBs& boxes, size_t first, size_t count);
+
+std::uint64_t checkAABBOverlapBatch(const engine::utils::Rect& query, const PackedAABBs& boxes, size_t first, size_t count);
+
+/// @brief 当前编译使用的批量检测实现（"AVX2" / "SSE" / "scalar"）
+const char* getAABBBatchBackend();
+
 // more...
 
 }   // namespace engine::physics::collision
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "collision_layer.h"
+#include <array>
+
+namespace engine::physics {
+
+    namespace {
+        struct LayerInfo {
+            std::string_view name;
+            CollisionMask layer;
+            CollisionMask default_mask;
+        };
+
+        constexpr CollisionMask ACTOR_MASK = CollisionLayer::PLAYER | CollisionLayer::SOLID | CollisionLayer::DEFAULT;
+
+        constexpr std::array<LayerInfo, 7> LAYERS = {{
+            {"default", CollisionLayer::DEFAULT, CollisionLayer::ALL},
+            {"solid",   CollisionLayer::SOLID,   CollisionLayer::ALL & ~CollisionLayer::SOLID},
+            {"player",  CollisionLayer::PLAYER,  CollisionLayer::ALL},
+            {"enemy",   CollisionLayer::ENEMY,   ACTOR_MASK},
+            {"item",    CollisionLayer::ITEM,    ACTOR_MASK},
+            {"hazard",  CollisionLayer::HAZARD,  CollisionLayer::PLAYER | CollisionLayer::DEFAULT},
+            {"trigger", CollisionLayer::TRIGGER, CollisionLayer::PLAYER | CollisionLayer::DEFAULT},
+        }};
+
+        std::string_view trim(std::string_view text) {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) text.remove_suffix(1);
+            return text;
+        }
+    }
+
+    std::optional<CollisionMask> getCollisionLayerByName(std::string_view name)
+    {
+        for (const auto& info : LAYERS) {
+            if (info.name == name) return info.layer;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<CollisionMask> parseCollisionMask(std::string_view text)
+    {
+        CollisionMask mask = CollisionLayer::NONE;
+        while (!text.empty()) {
+            const auto separator = text.find_first_of("|,");
+            const auto token = trim(text.substr(0, separator));
+            text = (separator == std::string_view::npos) ? std::string_view{} : text.substr(separator + 1);
+
+            if (token.empty() || token == "none") continue;
+            if (token == "all") {
+                mask = CollisionLayer::ALL;
+                continue;
+            }
+            auto layer = getCollisionLayerByName(token);
+            if (!layer) return std::nullopt;
+            mask |= *layer;
+        }
+        return mask;
+    }
+
+    CollisionMask getDefaultCollisionMask(CollisionMask layer)
+    {
+        CollisionMask mask = CollisionLayer::NONE;
+        for (const auto& info : LAYERS) {
+            if (layer & info.layer) mask |= info.default_mask;
+        }
+        // 自定义的层（未在表中）默认与所有层检测
+        if (layer & ~(CollisionLayer::DEFAULT | CollisionLayer::SOLID | CollisionLayer::PLAYER | CollisionLayer::ENEMY |
+                      CollisionLayer::ITEM | CollisionLayer::HAZARD | CollisionLayer::TRIGGER)) {
+            mask = CollisionLayer::ALL;
+        }
+        return mask;
+    }
+
+}   // namespace engine::physics
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace engine::physics {
+
+/// @brief 碰撞层位掩码
+using CollisionMask = std::uint32_t;
+
+/**
+ * @brief 预定义的碰撞层（位标志）
+ *
+ * 每个碰撞器有“所属层”（layer）和“检测掩码”（mask）。两个碰撞器只有在
+ * (a.layer & b.mask) != 0 且 (b.layer & a.mask) != 0 时才会被检测，宽阶段会直接剔除其它组合。
+ */
+struct CollisionLayer {
+    static constexpr CollisionMask NONE    = 0u;
+    static constexpr CollisionMask DEFAULT = 1u << 0;   // 未指定层的碰撞器
+    static constexpr CollisionMask SOLID   = 1u << 1;   // 阻挡物（推挤其它物体）
+    static constexpr CollisionMask PLAYER  = 1u << 2;   // 玩家
+    static constexpr CollisionMask ENEMY   = 1u << 3;   // 敌人
+    static constexpr CollisionMask ITEM    = 1u << 4;   // 道具
+    static constexpr CollisionMask HAZARD  = 1u << 5;   // 陷阱
+    static constexpr CollisionMask TRIGGER = 1u << 6;   // 关卡触发区域（如 next_level）
+    static constexpr CollisionMask ALL     = 0xFFFFFFFFu;
+};
+
+/// @brief 两组层/掩码是否需要检测碰撞
+inline bool shouldLayersCollide(CollisionMask layer_a, CollisionMask mask_a, CollisionMask layer_b, CollisionMask mask_b) {
+    return (layer_a & mask_b) != 0 && (layer_b & mask_a) != 0;
+}
+
+/**
+ * @brief 根据名称获取预定义的碰撞层（"default"、"solid"、"player"、"enemy"、"item"、"hazard"、"trigger"）
+ *
+ * @return std::optional<CollisionMask> 未知名称返回 std::nullopt
+ */
+std::optional<CollisionMask> getCollisionLayerByName(std::string_view name);
+
+/**
+ * @brief 解析碰撞层列表，名称之间用 '|' 或 ',' 分隔（如 "player|solid"），另支持 "all" 与 "none"
+ *
+ * @return std::optional<CollisionMask> 含有未知名称时返回 std::nullopt
+ */
+std::optional<CollisionMask> parseCollisionMask(std::string_view text);
+
+/**
+ * @brief 获取层的默认检测掩码（多个层时取并集）
+ *
+ * 道具、敌人、陷阱、触发区域之间互不检测，阻挡物之间互不检测。
+ */
+CollisionMask getDefaultCollisionMask(CollisionMask layer);
+
+}   // namespace engine::physics
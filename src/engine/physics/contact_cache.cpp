@@ -0,0 +1,98 @@
+#include "contact_cache.h"
+#include "broadphase.h"
+#include <algorithm>
+
+namespace engine::physics {
+
+    namespace {
+        // 64 位键的散列（Fibonacci 散列，高位分布较好）
+        inline size_t hashPairKey(std::uint64_t key, size_t mask) {
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        }
+    }
+
+    void ContactCache::beginStep()
+    {
+        events_.clear();
+        ++stamp_;
+    }
+
+    void ContactCache::touch(BodyHandle handle_a, BodyHandle handle_b, engine::object::GameObject *first, engine::object::GameObject *second)
+    {
+        const auto key = makePairKey(std::min(handle_a, handle_b), std::max(handle_a, handle_b));
+
+        // 保持负载因子不超过 1/2
+        if ((contacts_.size() + 1) * 2 > slots_.size()) {
+            rebuildIndex((contacts_.size() + 1) * 2);
+        }
+
+        const auto slot = findSlot(key);
+        if (slots_[slot] != 0) {
+            auto& contact = contacts_[slots_[slot] - 1];
+            if (contact.stamp == stamp_) return;    // 本步已记录
+            contact.stamp = stamp_;
+            contact.first = first;
+            contact.second = second;
+            events_.push_back(ContactEvent{first, second, ContactPhase::PERSIST});
+            return;
+        }
+
+        contacts_.push_back(Contact{key, first, second, stamp_});
+        slots_[slot] = static_cast<std::uint32_t>(contacts_.size());
+        events_.push_back(ContactEvent{first, second, ContactPhase::BEGIN});
+    }
+
+    void ContactCache::endStep()
+    {
+        size_t kept = 0;
+        for (const auto& contact : contacts_) {
+            if (contact.stamp == stamp_) {
+                contacts_[kept++] = contact;
+            } else {
+                events_.push_back(ContactEvent{contact.first, contact.second, ContactPhase::END});
+            }
+        }
+        if (kept != contacts_.size()) {
+            contacts_.resize(kept);
+            rebuildIndex(slots_.size());
+        }
+    }
+
+    void ContactCache::removeBody(BodyHandle handle)
+    {
+        auto it = std::remove_if(contacts_.begin(), contacts_.end(), [handle](const Contact& contact) {
+            return pairFirst(contact.key) == handle || pairSecond(contact.key) == handle;
+        });
+        if (it == contacts_.end()) return;
+        contacts_.erase(it, contacts_.end());
+        rebuildIndex(slots_.size());
+    }
+
+    void ContactCache::clear()
+    {
+        contacts_.clear();
+        events_.clear();
+        std::fill(slots_.begin(), slots_.end(), 0u);
+    }
+
+    size_t ContactCache::findSlot(std::uint64_t key) const
+    {
+        const size_t mask = slots_.size() - 1;
+        size_t slot = hashPairKey(key, mask);
+        while (slots_[slot] != 0 && contacts_[slots_[slot] - 1].key != key) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void ContactCache::rebuildIndex(size_t min_capacity)
+    {
+        size_t capacity = std::max<size_t>(slots_.size(), 16);
+        while (capacity < min_capacity) capacity *= 2;
+        slots_.assign(capacity, 0u);    // 容量不变时不会重新分配
+        for (size_t i = 0; i < contacts_.size(); ++i) {
+            slots_[findSlot(contacts_[i].key)] = static_cast<std::uint32_t>(i + 1);
+        }
+    }
+
+}   // namespace engine::physics
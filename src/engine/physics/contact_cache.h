@@ -0,0 +1,78 @@
+#pragma once
+#include "body_storage.h"
+#include <vector>
+#include <cstdint>
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::physics {
+
+/// @brief 物体间接触事件的阶段
+enum class ContactPhase : std::uint8_t {
+    BEGIN,      // 本步开始接触
+    PERSIST,    // 上一步与本步都在接触
+    END,        // 本步不再接触
+};
+
+/// @brief 物体间接触事件（first/second 的顺序与 getCollisionPairs() 中相同）
+struct ContactEvent {
+    engine::object::GameObject* first;
+    engine::object::GameObject* second;
+    ContactPhase phase;
+};
+
+/**
+ * @brief 持续接触缓存：以两个碰撞器所属刚体的句柄作为键，跨帧记录接触对，生成开始/持续/结束事件
+ *
+ * 接触对连续存放，另有开放寻址（线性探测）的散列索引。每步开始时 beginStep()，
+ * 窄阶段对每个接触调用 touch()，结束时 endStep() 为本步未再接触的对生成结束事件并压缩。
+ * 容器在帧间复用，接触数量稳定后不再产生堆分配。
+ */
+class ContactCache final {
+private:
+    struct Contact {
+        std::uint64_t key;                      // makePairKey(较小句柄, 较大句柄)
+        engine::object::GameObject* first;
+        engine::object::GameObject* second;
+        std::uint32_t stamp;                    // 最近一次接触所在的步
+    };
+
+    std::vector<Contact> contacts_;             // 当前所有接触对
+    std::vector<std::uint32_t> slots_;          // 散列索引：contacts_ 下标 + 1（0 为空槽），容量为 2 的幂
+    std::vector<ContactEvent> events_;          // 本步产生的事件
+    std::uint32_t stamp_ = 0;                   // 当前步编号
+
+public:
+    ContactCache() = default;
+
+    /// @brief 开始新的一步（清空上一步的事件）
+    void beginStep();
+
+    /**
+     * @brief 记录本步两个刚体发生接触，首次接触产生 BEGIN 事件，否则产生 PERSIST 事件（同一步内重复调用无效）
+     *
+     * @param handle_a/handle_b 两个刚体的句柄
+     * @param first/second 两个刚体所属的游戏对象（事件中按此顺序给出）
+     */
+    void touch(BodyHandle handle_a, BodyHandle handle_b, engine::object::GameObject* first, engine::object::GameObject* second);
+
+    /// @brief 结束本步：本步未接触的对产生 END 事件并被移除
+    void endStep();
+
+    /// @brief 移除与某刚体相关的所有接触（刚体被删除时调用，不产生事件，避免句柄复用后误判为持续接触）
+    void removeBody(BodyHandle handle);
+
+    /// @brief 清空所有接触与事件
+    void clear();
+
+    const std::vector<ContactEvent>& getEvents() const { return events_; }
+    size_t size() const { return contacts_.size(); }
+
+private:
+    size_t findSlot(std::uint64_t key) const;   // 键所在的槽，或应插入的空槽
+    void rebuildIndex(size_t min_capacity);     // 按 contacts_ 重新生成散列索引
+};
+
+}   // namespace engine::physics
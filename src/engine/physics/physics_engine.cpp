@@ -5,21 +5,55 @@
 #include "../component/tilelayer_component.h"
 #include "../object/game_object.h"
 #include "../physics/collision.h"
+#include "../core/thread_pool.h"
+#include "../utils/symbol.h"
 #include <spdlog/spdlog.h>
 #include <glm/glm.hpp>
-#include <set>
+#include <bit>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
 
 namespace engine::physics {
+namespace {
+    const engine::utils::Symbol SOLID_TAG{"solid"};     // 不可穿透物体的标签（由关卡加载器设置）
+} // namespace
+
+    BodyHandle PhysicsEngine::createBody(component::PhysicsComponent *component, bool use_gravity, float mass)
+    {
+        sweep_and_prune_.markDirty();   // 刚体下标发生变化，持久排序数组需要重建
+        return bodies_.create(component, use_gravity, mass);
+    }
+
     void PhysicsEngine::registerComponent(component::PhysicsComponent *component)
     {
-        components_.push_back(component);
+        auto handle = component->getBodyHandle();
+        if (!bodies_.isValid(handle)) {
+            spdlog::error("PhysicsEngine::registerComponent() - component has no valid body");
+            return;
+        }
+        auto index = bodies_.indexOf(handle);
+        bodies_.transform_[index] = component->getTransform();
+        bodies_.setFlag(index, BodyFlags::ATTACHED, component->getTransform() != nullptr);
+        // 碰撞器通常先于物理组件添加；若此时还没有，则在 gatherBodies 中再查找
+        auto* owner = component->getOwner();
+        if (owner && owner->hasComponent<engine::component::ColliderComponent>()) {
+            bodies_.collider_[index] = owner->getComponent<engine::component::ColliderComponent>();
+        }
+        if (bodies_.type_[index] == BodyType::STATIC) static_dirty_ = true;
         spdlog::trace("PhysicsEngine::registerComponent() - Registered component");
     }
 
     void PhysicsEngine::unregisterComponent(component::PhysicsComponent *component)
     {
-        auto it = std::remove(components_.begin(), components_.end(), component);
-        components_.erase(it, components_.end());
+        auto handle = component->getBodyHandle();
+        if (!bodies_.isValid(handle)) return;
+        if (bodies_.type_[bodies_.indexOf(handle)] == BodyType::STATIC) static_dirty_ = true;
+        contact_cache_.removeBody(handle);
+        removeRiderLinks(handle);
+        bodies_.destroy(handle);
+        sweep_and_prune_.markDirty();
         spdlog::trace("PhysicsEngine::unregisterComponent() - Unregistered component");
     }
 
@@ -27,6 +61,8 @@ namespace engine::physics {
     {
         tile_layer->setPhysicsEngine(this); // 设置物理引擎指针
         collision_tile_layers_.push_back(tile_layer);
+        rebuildPartition();
+        wakeAllBodies();    // 地形变化，休眠刚体需要重新检测
         spdlog::trace("PhysicsEngine::registerCollisionTileLayer() - Registered collision tile layer");
     }
 
@@ -34,114 +70,623 @@ namespace engine::physics {
     {
         auto it = std::remove(collision_tile_layers_.begin(), collision_tile_layers_.end(), tile_layer);
         collision_tile_layers_.erase(it, collision_tile_layers_.end());
+        rebuildPartition();
+        wakeAllBodies();
         spdlog::trace("PhysicsEngine::unregisterCollisionTileLayer() - Unregistered collision tile layer");
     }
 
+    void PhysicsEngine::setBodyType(BodyHandle handle, BodyType type)
+    {
+        if (!bodies_.isValid(handle)) {
+            spdlog::warn("PhysicsEngine::setBodyType() - invalid body handle {}", handle);
+            return;
+        }
+        auto index = bodies_.indexOf(handle);
+        if (bodies_.type_[index] == type) return;
+        if (bodies_.type_[index] == BodyType::STATIC || type == BodyType::STATIC) static_dirty_ = true;
+        bodies_.type_[index] = type;
+        bodies_.wake(index);
+    }
+
+    void PhysicsEngine::setWorldBounds(const engine::utils::Rect &world_bounds)
+    {
+        world_bounds_ = world_bounds;
+        rebuildPartition();
+    }
+
+    void PhysicsEngine::setRegionCulling(bool enable)
+    {
+        region_culling_ = enable;
+        if (enable) return;
+        // 关闭后所有刚体恢复每步模拟
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            bodies_.setFlag(i, BodyFlags::DORMANT, false);
+            bodies_.step_scale_[i] = 1.0f;
+        }
+    }
+
+    void PhysicsEngine::setRegionParams(int chunk_tiles, int active_radius, int reduced_radius, int reduced_interval)
+    {
+        chunk_tiles_ = std::max(chunk_tiles, 1);
+        partition_.setRadii(active_radius, reduced_radius);
+        partition_.setReducedInterval(reduced_interval);
+        rebuildPartition();
+    }
+
+    void PhysicsEngine::rebuildPartition()
+    {
+        // 区块尺寸取第一个碰撞瓦片层的瓦片尺寸；世界范围优先使用世界边界
+        glm::vec2 chunk_size = partition_.getChunkSize();
+        std::optional<engine::utils::Rect> world_rect = world_bounds_;
+        for (auto* layer : collision_tile_layers_) {
+            if (!layer) continue;
+            chunk_size = glm::vec2(layer->getTileSize()) * static_cast<float>(chunk_tiles_);
+            if (!world_rect) world_rect = engine::utils::Rect(glm::vec2(0.0f), layer->getWorldSize());
+            break;
+        }
+        partition_.configure(world_rect.value_or(engine::utils::Rect{}), chunk_size);
+    }
+
+    void PhysicsEngine::updateRegions()
+    {
+        out_of_world_objects_.clear();
+        ++step_count_;
+        const bool check_out_of_world = out_of_world_policy_ != OutOfWorldPolicy::KEEP &&
+                                        partition_.getWorldRect().size.x > 0.0f && partition_.getWorldRect().size.y > 0.0f;
+
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            if (bodies_.type_[i] == BodyType::STATIC || bodies_.always_active_[i] ||
+                (bodies_.flags_[i] & BodyFlags::SIMULATED) != BodyFlags::SIMULATED) {
+                bodies_.step_scale_[i] = 1.0f;
+                bodies_.setFlag(i, BodyFlags::DORMANT, false);
+                continue;
+            }
+            const auto aabb = getBodyAABB(i);
+
+            // 离开世界范围（如掉出地图底部）：停用，按策略删除所属对象
+            if (check_out_of_world && partition_.isOutOfWorld(aabb, out_of_world_margin_)) {
+                bodies_.setFlag(i, BodyFlags::ENABLED, false);
+                auto* obj = bodies_.component_[i]->getOwner();
+                if (obj) {
+                    if (out_of_world_policy_ == OutOfWorldPolicy::REMOVE) obj->setNeedRemove(true);
+                    out_of_world_objects_.push_back(obj);
+                    spdlog::debug("PhysicsEngine::updateRegions() - {} left the world", obj->getName());
+                }
+                continue;
+            }
+
+            // 降频刚体按句柄错开模拟的步
+            const auto tick = partition_.schedule(partition_.levelOf(aabb), step_count_, bodies_.handleOf(i));
+            bodies_.step_scale_[i] = tick.time_scale;
+            bodies_.setFlag(i, BodyFlags::DORMANT, !tick.run);
+        }
+    }
+
+    void PhysicsEngine::setSleepEnabled(bool enable)
+    {
+        sleep_enabled_ = enable;
+        if (!enable) wakeAllBodies();
+    }
+
+    void PhysicsEngine::wakeAllBodies()
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            bodies_.wake(i);
+        }
+    }
+
+    void PhysicsEngine::setDeterministic(bool enabled, float fixed_delta_time)
+    {
+        deterministic_ = enabled;
+        if (fixed_delta_time > 0.0f) fixed_delta_time_ = fixed_delta_time;
+        spdlog::info("PhysicsEngine::setDeterministic() - enabled: {}, fixed delta time: {}", enabled, fixed_delta_time_);
+    }
+
+    std::uint64_t PhysicsEngine::computeStateHash() const
+    {
+        // FNV-1a，按稠密下标顺序（由创建/删除顺序决定）逐个混入各刚体的数据
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        auto mix = [&hash](std::uint32_t value) {
+            for (int i = 0; i < 4; ++i) {
+                hash ^= (value >> (i * 8)) & 0xFFu;
+                hash *= 0x100000001b3ull;
+            }
+        };
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            mix(bodies_.handleOf(i));
+            mix(std::bit_cast<std::uint32_t>(bodies_.position_[i].x));
+            mix(std::bit_cast<std::uint32_t>(bodies_.position_[i].y));
+            mix(std::bit_cast<std::uint32_t>(bodies_.velocity_[i].x));
+            mix(std::bit_cast<std::uint32_t>(bodies_.velocity_[i].y));
+            mix(bodies_.flags_[i]);
+        }
+        return hash;
+    }
+
     void PhysicsEngine::update(float delta_time)
     {
+        // 确定性模式下每步的时间固定，不受帧率影响
+        if (deterministic_) delta_time = fixed_delta_time_;
 
         collision_pairs_.clear();
+        contact_cache_.beginStep();
         tile_trigger_events_.clear();
 
-        for (auto* pc : components_)
+        // 收集位置与包围盒，之后的计算都在连续数组上进行
+        gatherBodies();
+
+        // 按所在区块决定本步的模拟级别，处理离开世界的刚体
+        if (region_culling_) updateRegions();
+
+        // 静态刚体集合变化（添加/删除/移动）时重建静态加速结构，并唤醒可能失去支撑的休眠刚体
+        if (static_dirty_) {
+            rebuildStaticGrid();
+        }
+
+        // 乘客随承载体（移动平台）一起移动，位移在下面的瓦片碰撞中与自身位移一并处理
+        // （在积分之前进行，被唤醒的乘客本步也会受重力而压在承载体上，保持接触）
+        carryRiders(delta_time);
+
+        // 速度积分（重置碰撞标志、重力、外力、限速）
+        integrateBodies(delta_time);
+
+        // 每个刚体只读瓦片层、只写自身数据，可以并行处理
+        forEachRange(bodies_.size(), [this, delta_time](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                // 静态、休眠与冻结中的刚体不移动
+                if ((bodies_.flags_[i] & (BodyFlags::SIMULATED | BodyFlags::INACTIVE)) != BodyFlags::SIMULATED) continue;
+                if (bodies_.type_[i] == BodyType::STATIC) continue;
+                const float step_time = delta_time * bodies_.step_scale_[i];   // 降频模拟的刚体按累计的时间推进
+                if (bodies_.type_[i] == BodyType::KINEMATIC) {
+                    bodies_.position_[i] += bodies_.velocity_[i] * step_time;   // 运动学刚体只按速度移动
+                    continue;
+                }
+
+                // 处理瓦片层碰撞（位置的更新也在此）
+                resolveTileCollision(i, step_time);
+
+                // 世界边缘处理
+                applyWorldBounds(i);
+            }
+        });
+
+        // 写回位置，物体间碰撞的精确检测需要读取 TransformComponent
+        writeBackPositions();
+
+        // 对象间的碰撞（本步未再接触的对产生结束事件）
+        checkObjectCollision();
+        contact_cache_.endStep();
+        updateRiders();
+        for (auto index : deferred_wakes_) {
+            bodies_.wake(index);
+        }
+        deferred_wakes_.clear();
+
+        // 静止足够久的动态刚体进入休眠（接触事件已在上一步重置计时）
+        updateSleeping(delta_time);
+
+        // 检测瓦片触发事件（检测前已经处理完位移）
+        checkTileTriggers();
+
+        // 刚体已移动，空间查询结构在下次查询时重建
+        query_grid_dirty_ = true;
+    }
+
+    void PhysicsEngine::gatherBodies()
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i)
         {
-            if (!pc || !pc->isEnable()) // Check if the component is valid and enabled
+            auto* tc = bodies_.transform_[i];
+            if (!tc) continue;  // 尚未绑定，不参与模拟
+            auto*& cc = bodies_.collider_[i];
+            if (!cc) {
+                auto* obj = bodies_.component_[i]->getOwner();
+                if (obj && obj->hasComponent<engine::component::ColliderComponent>()) {
+                    cc = obj->getComponent<engine::component::ColliderComponent>();
+                }
+            }
+
+            const auto& position = tc->getPosition();
+            if (bodies_.hasFlag(i, BodyFlags::SLEEPING)) {
+                // 外部修改了位置、速度或施加了力，唤醒刚体（速度/受力在休眠时被清零，任何写入都会被发现）
+                if (position != bodies_.position_[i] || bodies_.velocity_[i] != glm::vec2(0.0f) || bodies_.force_[i] != glm::vec2(0.0f)) {
+                    bodies_.wake(i);
+                }
+            }
+
+            const bool is_static = bodies_.type_[i] == BodyType::STATIC;
+            const auto old_aabb = getBodyAABB(i);
+            const auto old_flags = bodies_.flags_[i];
+            const auto old_layer = bodies_.collision_layer_[i];
+            const auto old_mask = bodies_.collision_mask_[i];
+
+            bodies_.position_[i] = position;
+            bodies_.setFlag(i, BodyFlags::HAS_COLLIDER, cc != nullptr);
+            if (cc) {
+                // 偏移与缩放可能在运行时改变，每帧刷新
+                const auto* collider = cc->getCollider();
+                bodies_.aabb_offset_[i] = cc->getOffset();
+                bodies_.aabb_size_[i] = collider ? collider->getAABBSize() * tc->getScale() : glm::vec2(0.0f);
+                bodies_.shape_[i] = collider ? collider->getType() : ColliderType::NONE;
+                bodies_.setFlag(i, BodyFlags::COLLIDER_ACTIVE, cc->isActive());
+                bodies_.setFlag(i, BodyFlags::TRIGGER, cc->isTrigger());
+                bodies_.collision_layer_[i] = cc->getCollisionLayer();
+                bodies_.collision_mask_[i] = cc->getCollisionMask();
+            }
+
+            // 静态刚体被移动或修改了碰撞器，下次生成候选对前重建静态加速结构
+            if (is_static && !static_dirty_) {
+                const auto new_aabb = getBodyAABB(i);
+                static_dirty_ = new_aabb.position != old_aabb.position || new_aabb.size != old_aabb.size ||
+                                bodies_.flags_[i] != old_flags ||
+                                bodies_.collision_layer_[i] != old_layer || bodies_.collision_mask_[i] != old_mask;
+            }
+        }
+    }
+
+    void PhysicsEngine::integrateBodies(float delta_time)
+    {
+        // 直接在连续数组上循环，没有指针追踪与分支，便于编译器向量化
+        glm::vec2* velocity = bodies_.velocity_.data();
+        glm::vec2* force = bodies_.force_.data();
+        const float* inv_mass = bodies_.inv_mass_.data();
+        std::uint16_t* flags = bodies_.flags_.data();
+        const glm::vec2 gravity = gravity_;
+        const float max_speed = max_speed_;
+
+        const BodyType* type = bodies_.type_.data();
+        const float* step_scale = bodies_.step_scale_.data();
+
+        forEachRange(bodies_.size(), [=](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i)
             {
+                // 休眠中的刚体保持速度为零与碰撞状态不变；运动学刚体不受力和重力影响；静态刚体不积分
+                const bool active = (flags[i] & (BodyFlags::SIMULATED | BodyFlags::INACTIVE)) == BodyFlags::SIMULATED;
+                const bool dynamic = active && type[i] == BodyType::DYNAMIC;
+                const bool moving = active && type[i] != BodyType::STATIC;
+                const float gravity_scale = (flags[i] & BodyFlags::USE_GRAVITY) ? 1.0f : 0.0f;
+                /* 还可以添加其他力影响，如风力、摩擦力等，目前不考虑 */
+
+                // 更新速度 v = v0 + a * t, a = F / m + g，并限制最大速度
+                const glm::vec2 acceleration = force[i] * inv_mass[i] + gravity * gravity_scale;
+                const glm::vec2 new_velocity = glm::clamp(velocity[i] + acceleration * (delta_time * step_scale[i]), -max_speed, max_speed);
+
+                velocity[i] = dynamic ? new_velocity : velocity[i];
+                force[i] = active ? glm::vec2(0.0f) : force[i];  //清除当前帧的力
+                flags[i] = moving ? static_cast<std::uint16_t>(flags[i] & ~BodyFlags::COLLISION_STATE) : flags[i];   // 重置碰撞标志位
+            }
+        });
+    }
+
+    void PhysicsEngine::writeBackPositions()
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            if ((bodies_.flags_[i] & (BodyFlags::SIMULATED | BodyFlags::INACTIVE)) != BodyFlags::SIMULATED) continue;
+            if (bodies_.type_[i] == BodyType::STATIC) continue;
+            bodies_.transform_[i]->setPosition(bodies_.position_[i]);
+        }
+    }
+
+    void PhysicsEngine::updateSleeping(float delta_time)
+    {
+        if (!sleep_enabled_) return;
+        const float threshold_sq = sleep_velocity_threshold_ * sleep_velocity_threshold_;
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            if ((bodies_.flags_[i] & (BodyFlags::SIMULATED | BodyFlags::INACTIVE)) != BodyFlags::SIMULATED) continue;
+            if (bodies_.type_[i] != BodyType::DYNAMIC) continue;
+
+            const auto& velocity = bodies_.velocity_[i];
+            if (velocity.x * velocity.x + velocity.y * velocity.y > threshold_sq) {
+                bodies_.sleep_timer_[i] = 0.0f;
                 continue;
             }
+            bodies_.sleep_timer_[i] += delta_time;
+            if (bodies_.sleep_timer_[i] >= sleep_time_) {
+                bodies_.velocity_[i] = {0.0f, 0.0f};
+                bodies_.setFlag(i, BodyFlags::SLEEPING, true);
+            }
+        }
+    }
 
-            pc->resetCollisionFlags(); // 重置碰撞标志位
+    void PhysicsEngine::rebuildStaticGrid()
+    {
+        static_grid_.clear();
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            if (bodies_.type_[i] == BodyType::STATIC && isCollidable(i)) {
+                static_grid_.insert(bodies_.handleOf(i), getBodyAABB(i), bodies_.collision_layer_[i], bodies_.collision_mask_[i]);
+            }
+        }
+        static_grid_.build();
+        static_dirty_ = false;
+        // 静态刚体可能是休眠刚体的支撑物，集合变化后全部唤醒重新检测
+        wakeAllBodies();
+        spdlog::debug("PhysicsEngine::rebuildStaticGrid() - rebuilt static acceleration structure");
+    }
 
-            if (pc->isUseGravity())
-            {
-                pc->addForce(gravity_ * pc->getMass());
+    void PhysicsEngine::addStaticCandidatePairs()
+    {
+        const size_t dynamic_pair_count = candidate_pairs_.size();
+        const auto chunk_count = forEachRange(bodies_.size(), [this](size_t begin, size_t end, size_t chunk) {
+            auto& out_pairs = chunk_pairs_[chunk];
+            auto& query_buffer = chunk_query_buffers_[chunk];
+            out_pairs.clear();
+            for (size_t i = begin; i < end; ++i) {
+                if (!isCollidable(i) || isBodyResting(i)) continue;
+                const auto aabb = getBodyAABB(i);
+                query_buffer.clear();
+                static_grid_.query(aabb, query_buffer);
+                for (auto handle : query_buffer) {
+                    if (!bodies_.isValid(handle)) continue;
+                    const auto j = bodies_.indexOf(handle);
+                    if (!shouldBodiesCollide(i, j) || !collision::checkRectOverlap(aabb, getBodyAABB(j))) continue;
+                    const auto self = static_cast<std::uint32_t>(i);
+                    out_pairs.push_back(makePairKey(std::min(self, j), std::max(self, j)));
+                }
             }
-            /* 还可以添加其他力影响，如风力、摩擦力等，目前不考虑 */
+        });
+        mergeChunkPairs(chunk_count);
+        // 合并后重新排序去重（静态查询可能因跨越多个网格而重复）
+        if (candidate_pairs_.size() != dynamic_pair_count) {
+            std::sort(candidate_pairs_.begin(), candidate_pairs_.end());
+            candidate_pairs_.erase(std::unique(candidate_pairs_.begin(), candidate_pairs_.end()), candidate_pairs_.end());
+        }
+    }
 
-            // 更新速度 v = v0 + a * t, a = F / m
-            pc->velocity_ += (pc->getForce() / pc->getMass()) * delta_time;
-            pc->clearForce();   //清除当前帧的力
+    void PhysicsEngine::checkObjectCollision()
+    {
+        if (broadphase_type_ == BroadphaseType::BRUTE_FORCE) {
+            for (size_t i = 0; i < bodies_.size(); ++i) {
+                if (!isCollidable(i)) continue;
+                for (size_t j = i + 1; j < bodies_.size(); ++j) {
+                    if (!isCollidable(j) || !shouldBodiesCollide(i, j)) continue;
+                    processObjectPair(i, j);
+                }
+            }
+            return;
+        }
 
-            // 处理瓦片层碰撞（速度和位置的更新也在此）
-            resolveTileCollision(pc, delta_time);
+        generateCandidatePairs();
+        if (validate_broadphase_) {
+            validateCandidatePairs();
+        }
 
-            // 世界边缘处理
-            applyWorldBounds(pc);
+        // 候选对已按 (i, j) 升序排列，处理顺序与暴力检测一致；
+        // 若某物体被 SOLID 推挤，其新位置产生的候选对放入小顶堆，与原序列按序合并
+        extra_pairs_.clear();
+        moved_bodies_.clear();
+        size_t next = 0;
+        while (next < candidate_pairs_.size() || !extra_pairs_.empty()) {
+            std::uint64_t key = 0;
+            if (extra_pairs_.empty() || (next < candidate_pairs_.size() && candidate_pairs_[next] <= extra_pairs_.front())) {
+                key = candidate_pairs_[next++];
+            } else {
+                key = extra_pairs_.front();
+            }
+            // 跳过两个序列中的重复项
+            while (!extra_pairs_.empty() && extra_pairs_.front() == key) {
+                std::pop_heap(extra_pairs_.begin(), extra_pairs_.end(), std::greater<>());
+                extra_pairs_.pop_back();
+            }
+            while (next < candidate_pairs_.size() && candidate_pairs_[next] == key) ++next;
 
+            if (auto moved = processObjectPair(pairFirst(key), pairSecond(key)); moved) {
+                addCandidatesForMovedBody(*moved, key);
+            }
         }
+    }
 
-        // 对象间的碰撞
-        checkObjectCollision();
+    void PhysicsEngine::addCandidatesForMovedBody(size_t index, std::uint64_t current_key)
+    {
+        if (std::find(moved_bodies_.begin(), moved_bodies_.end(), index) == moved_bodies_.end()) {
+            moved_bodies_.push_back(index);
+        }
 
-        // 检测瓦片触发事件（检测前已经处理完位移）
-        checkTileTriggers();
+        // 网格中记录的是其他物体在宽阶段时的位置；移动过的物体位置已改变，需要额外逐个比较
+        query_buffer_.clear();
+        queryBroadphase(getBodyAABB(index), query_buffer_);
+        for (auto other : moved_bodies_) {
+            query_buffer_.push_back(static_cast<std::uint32_t>(other));
+        }
+
+        const auto self = static_cast<std::uint32_t>(index);
+        for (auto other : query_buffer_) {
+            if (other == self || !shouldBodiesCollide(index, other)) continue;
+            auto key = makePairKey(std::min(self, other), std::max(self, other));
+            if (key <= current_key) continue;   // 已处理过的对不再重复处理（与暴力检测一致）
+            extra_pairs_.push_back(key);
+            std::push_heap(extra_pairs_.begin(), extra_pairs_.end(), std::greater<>());
+        }
     }
 
-    void PhysicsEngine::checkObjectCollision()
+    void PhysicsEngine::generateCandidatePairs()
     {
-        for (size_t i = 0; i < components_.size(); ++i)
+        candidate_pairs_.clear();
+
+        // 动态加速结构中只包含非静态刚体，静态刚体之间永远不会生成候选对
+        switch (broadphase_type_)
         {
-            auto* pc_a = components_[i];
-            if (!pc_a || !pc_a->isEnable()) continue; // Check if the component is valid and enabled
-            auto* obj_a = pc_a->getOwner();
-            if (!obj_a) continue;
-            auto* cc_a = obj_a->getComponent<engine::component::ColliderComponent>();
-            if (!cc_a || !cc_a->isActive()) continue;
-
-            for (size_t j = i + 1; j < components_.size(); ++j){
-                auto* pc_b = components_[j];
-                if (!pc_b || !pc_b->isEnable()) continue; // Check if the component is valid and enabled
-                auto* obj_b = pc_b->getOwner();
-                if (!obj_b) continue;
-                auto* cc_b = obj_b->getComponent<engine::component::ColliderComponent>();
-                if (!cc_b || !cc_b->isActive()) continue;
-
-                if (collision::checkCollision(*cc_a, *cc_b)) {
-                    // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
-                    if (obj_a->getTag() != "solid" && obj_b->getTag() == "solid")
-                    {
-                        resolveSolidObjectCollision(obj_a, obj_b);
-                    }
-                    else if (obj_a->getTag() == "solid" && obj_b->getTag() != "solid")
-                    {
-                        resolveSolidObjectCollision(obj_b, obj_a);
-                    }
-                    else
-                    {
-                        collision_pairs_.emplace_back(obj_a, obj_b);
+            case BroadphaseType::UNIFORM_GRID:
+            {
+                uniform_grid_.clear();
+                for (size_t i = 0; i < bodies_.size(); ++i) {
+                    if (isCollidable(i) && bodies_.type_[i] != BodyType::STATIC) {
+                        uniform_grid_.insert(static_cast<std::uint32_t>(i), getBodyAABB(i), bodies_.collision_layer_[i], bodies_.collision_mask_[i]);
                     }
                 }
+                // 按网格分块并行生成，合并后排序去重（与串行的 computePairs 结果相同）
+                const auto chunk_count = forEachRange(uniform_grid_.prepareRuns(), [this](size_t begin, size_t end, size_t chunk) {
+                    chunk_pairs_[chunk].clear();
+                    uniform_grid_.computeRunPairs(begin, end, chunk_pairs_[chunk], chunk_scratch_[chunk]);
+                });
+                mergeChunkPairs(chunk_count);
+                uniform_grid_.computeOversizedPairs(candidate_pairs_);
+                std::sort(candidate_pairs_.begin(), candidate_pairs_.end());
+                candidate_pairs_.erase(std::unique(candidate_pairs_.begin(), candidate_pairs_.end()), candidate_pairs_.end());
+                break;
+            }
+            case BroadphaseType::SWEEP_AND_PRUNE:
+            {
+                sweep_and_prune_.beginUpdate(bodies_.size());
+                for (size_t i = 0; i < bodies_.size(); ++i) {
+                    sweep_and_prune_.setProxy(static_cast<std::uint32_t>(i), getBodyAABB(i), isCollidable(i) && bodies_.type_[i] != BodyType::STATIC,
+                                              bodies_.collision_layer_[i], bodies_.collision_mask_[i]);
+                }
+                sweep_and_prune_.finishUpdate();
+
+                // 按排序位置分块并行扫描，合并后排序（与串行的 computePairs 结果相同）
+                const auto chunk_count = forEachRange(sweep_and_prune_.getProxyCount(), [this](size_t begin, size_t end, size_t chunk) {
+                    chunk_pairs_[chunk].clear();
+                    sweep_and_prune_.computePairsInRange(begin, end, chunk_pairs_[chunk]);
+                });
+                mergeChunkPairs(chunk_count);
+                std::sort(candidate_pairs_.begin(), candidate_pairs_.end());
+                break;
+            }
+            case BroadphaseType::BRUTE_FORCE:   // 暴力检测直接在 checkObjectCollision 中双重循环，不生成候选对
+            default:
+                return;
+        }
+
+        // 两个休眠刚体之间不需要检测
+        std::erase_if(candidate_pairs_, [this](std::uint64_t key) {
+            return isBodyResting(pairFirst(key)) && isBodyResting(pairSecond(key));
+        });
+        addStaticCandidatePairs();
+    }
+
+    size_t PhysicsEngine::forEachRange(size_t count, const std::function<void(size_t, size_t, size_t)> &task)
+    {
+        const size_t max_chunks = thread_pool_ ? thread_pool_->getThreadCount() : 1;
+        if (chunk_pairs_.size() < max_chunks) {
+            chunk_pairs_.resize(max_chunks);
+            chunk_trigger_events_.resize(max_chunks);
+            chunk_query_buffers_.resize(max_chunks);
+            chunk_scratch_.resize(max_chunks);
+        }
+        if (!thread_pool_) {
+            if (count > 0) task(0, count, 0);
+            return count > 0 ? 1 : 0;
+        }
+        return thread_pool_->parallelFor(count, parallel_min_batch_, task);
+    }
+
+    void PhysicsEngine::mergeChunkPairs(size_t chunk_count)
+    {
+        for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+            candidate_pairs_.insert(candidate_pairs_.end(), chunk_pairs_[chunk].begin(), chunk_pairs_[chunk].end());
+        }
+    }
+
+    void PhysicsEngine::validateCandidatePairs() const
+    {
+        // 宽阶段只要求“不漏检”：所有包围盒重叠的对都必须出现在候选对中
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            if (!isCollidable(i)) continue;
+            auto aabb_a = getBodyAABB(i);
+            for (size_t j = i + 1; j < bodies_.size(); ++j) {
+                if (!isCollidable(j) || !shouldBodiesCollide(i, j)) continue;
+                if (!collision::checkRectOverlap(aabb_a, getBodyAABB(j))) continue;
+
+                auto key = makePairKey(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j));
+                if (!std::binary_search(candidate_pairs_.begin(), candidate_pairs_.end(), key)) {
+                    spdlog::warn("PhysicsEngine::validateCandidatePairs() - broadphase missed pair ({}, {}): {} vs {}",
+                                 i, j, bodies_.component_[i]->getOwner()->getName(), bodies_.component_[j]->getOwner()->getName());
+                }
             }
         }
     }
 
-    void PhysicsEngine::resolveTileCollision(engine::component::PhysicsComponent *pc, float delta_time)
+    void PhysicsEngine::queryBroadphase(const engine::utils::Rect &aabb, std::vector<std::uint32_t> &out_ids) const
+    {
+        switch (broadphase_type_)
+        {
+            case BroadphaseType::UNIFORM_GRID:
+                uniform_grid_.query(aabb, out_ids);
+                appendStaticQuery(aabb, out_ids);
+                break;
+            case BroadphaseType::SWEEP_AND_PRUNE:
+                sweep_and_prune_.query(aabb, out_ids);
+                appendStaticQuery(aabb, out_ids);
+                break;
+            case BroadphaseType::BRUTE_FORCE:
+            default:
+                for (size_t i = 0; i < bodies_.size(); ++i) {
+                    if (isCollidable(i)) out_ids.push_back(static_cast<std::uint32_t>(i));
+                }
+                break;
+        }
+    }
+
+    void PhysicsEngine::appendStaticQuery(const engine::utils::Rect &aabb, std::vector<std::uint32_t> &out_ids) const
     {
-        // 检查组件是否有效
-        auto* obj = pc->getOwner();
-        if (!obj) return;
-        auto* tc = obj->getComponent<engine::component::TransformComponent>();
-        auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-        if (!tc || !cc || cc->isTrigger()) return;
-        auto world_aabb = cc->getWorldAABB();       // 使用最小包围盒进行碰撞检测（简化碰撞检测）
+        const auto begin = out_ids.size();
+        static_grid_.query(aabb, out_ids);
+        // 静态加速结构中保存的是句柄，剔除已删除刚体的旧句柄后换算为当前稠密下标
+        const auto stale = std::remove_if(out_ids.begin() + static_cast<std::ptrdiff_t>(begin), out_ids.end(),
+                                          [this](std::uint32_t handle) { return !bodies_.isValid(handle); });
+        out_ids.erase(stale, out_ids.end());
+        for (auto i = begin; i < out_ids.size(); ++i) {
+            out_ids[i] = bodies_.indexOf(out_ids[i]);
+        }
+    }
+
+    std::optional<size_t> PhysicsEngine::processObjectPair(size_t index_a, size_t index_b)
+    {
+        auto* obj_a = bodies_.component_[index_a]->getOwner();
+        auto* obj_b = bodies_.component_[index_b]->getOwner();
+        const bool solid_a = obj_a->getTagSymbol() == SOLID_TAG;
+        const bool solid_b = obj_b->getTagSymbol() == SOLID_TAG;
+
+        // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对（接触信息以可移动物体为 a 计算）
+        collision::Contact contact;
+        if (!solid_a && solid_b) {
+            if (collision::computeContact(getBodyShape(index_a), getBodyShape(index_b), contact) &&
+                resolveSolidObjectCollision(index_a, index_b, contact)) return index_a;
+        } else if (solid_a && !solid_b) {
+            if (collision::computeContact(getBodyShape(index_b), getBodyShape(index_a), contact) &&
+                resolveSolidObjectCollision(index_b, index_a, contact)) return index_b;
+        } else if (collision::computeContact(getBodyShape(index_a), getBodyShape(index_b), contact)) {
+            // 发生接触的刚体保持唤醒（停靠在 SOLID 上不算接触，否则永远无法休眠）
+            deferWake(index_a);
+            deferWake(index_b);
+            collision_pairs_.emplace_back(obj_a, obj_b);
+            contact_cache_.touch(bodies_.handleOf(index_a), bodies_.handleOf(index_b), obj_a, obj_b);
+        }
+        return std::nullopt;
+    }
+
+    void PhysicsEngine::resolveTileCollision(size_t index, float delta_time)
+    {
+        const auto carry_offset = std::exchange(bodies_.carry_offset_[index], glm::vec2(0.0f));   // 随承载体的位移（见 carryRiders）
+        // 没有碰撞器或是触发器的刚体不移动
+        if (!bodies_.hasFlag(index, BodyFlags::HAS_COLLIDER) || bodies_.hasFlag(index, BodyFlags::TRIGGER)) return;
+        auto world_aabb = getBodyAABB(index);       // 使用最小包围盒进行碰撞检测（简化碰撞检测）
         auto obj_pos = world_aabb.position;
         auto obj_size = world_aabb.size;
         if (world_aabb.size.x <= 0.0f || world_aabb.size.y <= 0.0f) return;
 
+        auto& velocity = bodies_.velocity_[index];
+        auto& position = bodies_.position_[index];
+        const bool is_bullet = bodies_.hasFlag(index, BodyFlags::BULLET);
 
         constexpr float tolerance = 1.0f; // 检测右/下边缘时，需要减1像素，否则会检测到下一行/列的瓦片(地图瓦片位置序号从0开始，计算结果位置为2其实是1号瓦片)
-        auto ds = pc->velocity_ * delta_time;   // 速度 * 时间 = 距离，计算移动距离
+        auto ds = velocity * delta_time + carry_offset;    // 速度 * 时间 = 距离，计算移动距离（加上随承载体的位移）
         auto new_obj_pos = obj_pos + ds;   // 新位置 = 旧位置 + 距离
 
-        if (!cc->isActive()){   // 如果碰撞器未激活，则不进行碰撞检测，让物体正常移动然后返回
-            tc->translate(ds);
-            pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
+        if (!bodies_.hasFlag(index, BodyFlags::COLLIDER_ACTIVE)){   // 如果碰撞器未激活，则不进行碰撞检测，让物体正常移动然后返回
+            position += ds;
             return;
         }
+        // 高速物体：先沿位移扫掠，路径上碰到瓦片时由扫掠决定位置；未碰到时照常检测目标位置（斜坡、梯子顶等）
+        if (is_bullet && sweepBulletTiles(index, obj_pos, obj_size, ds)) return;
 
         for (auto* layer : collision_tile_layers_){
             if (!layer) continue;
 
+            const auto& view = layer->getCollisionView();
             auto tile_size = layer->getTileSize();
             // 期望位置计算，用于检测碰撞
             if (ds.x > 0.0f) {  // 向右移动
@@ -149,24 +694,24 @@ namespace engine::physics {
                 auto right_top_x = new_obj_pos.x + obj_size.x;
                 auto tile_x = static_cast<int>(floor(right_top_x / tile_size.x));   // 获取x方向瓦片坐标
                 auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));       // 获取y方向瓦片右上坐标
-                auto tile_type_top = layer->getTileTypeAt({tile_x, tile_y});
+                auto tile_type_top = view.typeAt(tile_x, tile_y);
                 auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));   // 获取y方向瓦片右下坐标
-                auto tile_type_bottom = layer->getTileTypeAt({tile_x, tile_y_bottom});
+                auto tile_type_bottom = view.typeAt(tile_x, tile_y_bottom);
 
                 if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID) {
                     // 碰撞了，停止移动
-                    pc->velocity_.x = 0.0f;
+                    velocity.x = 0.0f;
                     new_obj_pos.x = tile_x * tile_size.x - obj_size.x;
-                    pc->setCollidedRight(true);
+                    bodies_.setFlag(index, BodyFlags::COLLIDED_RIGHT, true);
                 } else {
                     // 检测右下角斜坡瓦片
                     auto width_right = new_obj_pos.x + obj_size.x - tile_x * tile_size.x;
-                    auto height_right = getTileHeightAtWidth(width_right, tile_type_bottom, tile_size);
+                    auto height_right = view.slopeHeightAt(tile_type_bottom, width_right);
                     if (height_right > 0.0f) {
                         // 如果有碰撞（角点的世界y坐标 > 斜坡地面的世界y坐标），就让物体贴着斜坡表面
                         if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right) {
                             new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right;
-                            pc->setCollidedBelow(true);
+                            bodies_.setFlag(index, BodyFlags::COLLIDED_BELOW, true);
                         }
                     }
                 }
@@ -176,22 +721,22 @@ namespace engine::physics {
                 auto left_top_x = new_obj_pos.x;
                 auto tile_x = static_cast<int>(floor(left_top_x / tile_size.x));   // 获取x方向瓦片坐标
                 auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));       // 获取y方向瓦片右上坐标
-                auto tile_type_top = layer->getTileTypeAt({tile_x, tile_y});    // 左上角瓦片类型
+                auto tile_type_top = view.typeAt(tile_x, tile_y);    // 左上角瓦片类型
                 auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));   // 获取y方向瓦片右下坐标
-                auto tile_type_bottom = layer->getTileTypeAt({tile_x, tile_y_bottom});  //左下角瓦片类型
+                auto tile_type_bottom = view.typeAt(tile_x, tile_y_bottom);  //左下角瓦片类型
 
                 if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID) {
-                    pc->velocity_.x = 0.0f;
+                    velocity.x = 0.0f;
                     new_obj_pos.x = (tile_x + 1) * tile_size.x;
-                    pc->setCollidedLeft(true);
+                    bodies_.setFlag(index, BodyFlags::COLLIDED_LEFT, true);
                 } else {
                     // 检测左下角斜坡瓦片
                     auto width_left = new_obj_pos.x - tile_x * tile_size.x;
-                    auto height_left = getTileHeightAtWidth(width_left, tile_type_bottom, tile_size);
+                    auto height_left = view.slopeHeightAt(tile_type_bottom, width_left);
                     if (height_left > 0.0f) {
                         if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left) {
                             new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left;
-                            pc->setCollidedBelow(true);
+                            bodies_.setFlag(index, BodyFlags::COLLIDED_BELOW, true);
                         }
                     }
                 }
@@ -202,41 +747,41 @@ namespace engine::physics {
                 auto botton_left_y = new_obj_pos.y + obj_size.y;
                 auto tile_y = static_cast<int>(floor(botton_left_y / tile_size.y));   // 获取y方向瓦片坐标
                 auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));       // 获取x方向瓦片左下坐标
-                auto tile_type_left = layer->getTileTypeAt({tile_x, tile_y});
+                auto tile_type_left = view.typeAt(tile_x, tile_y);
                 auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));   // 获取x方向瓦片右下坐标
-                auto tile_type_right = layer->getTileTypeAt({tile_x_right, tile_y});
+                auto tile_type_right = view.typeAt(tile_x_right, tile_y);
 
                 if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID ||
                     tile_type_left == engine::component::TileType::UNISOLID || tile_type_right == engine::component::TileType::UNISOLID) {
-                    pc->velocity_.y = 0.0f;
+                    velocity.y = 0.0f;
                     new_obj_pos.y = tile_y * tile_size.y - obj_size.y;
-                    pc->setCollidedBelow(true);
+                    bodies_.setFlag(index, BodyFlags::COLLIDED_BELOW, true);
                 //如果两个角点都位于梯子上，则判断是不是处于梯子顶
                 } else if (tile_type_left == engine::component::TileType::LADDER && tile_type_right == engine::component::TileType::LADDER) {
-                    auto tile_type_up_l = layer->getTileTypeAt({tile_x, tile_y - 1});   //检测左角点上方瓦片类型
-                    auto tile_type_up_r = layer->getTileTypeAt({tile_x_right, tile_y - 1});   //检测右角点上方瓦片类型
+                    auto tile_type_up_l = view.typeAt(tile_x, tile_y - 1);   //检测左角点上方瓦片类型
+                    auto tile_type_up_r = view.typeAt(tile_x_right, tile_y - 1);   //检测右角点上方瓦片类型
                     // 如果上方不是梯子，证明处梯子顶
                     if (tile_type_up_l != engine::component::TileType::LADDER && tile_type_up_r != engine::component::TileType::LADDER){
-                        if (pc->isUseGravity()){ // 非攀爬状态
+                        if (bodies_.hasFlag(index, BodyFlags::USE_GRAVITY)){ // 非攀爬状态
                             //让物体贴着梯子顶层位置（与 SOLID 情况相同）
-                            pc->setOnTopLadder(true);
-                            pc->setCollidedBelow(true);
+                            bodies_.setFlag(index, BodyFlags::ON_TOP_LADDER, true);
+                            bodies_.setFlag(index, BodyFlags::COLLIDED_BELOW, true);
                             new_obj_pos.y = tile_y * tile_size.y - obj_size.y;
-                            pc->velocity_.y = 0.0f;
+                            velocity.y = 0.0f;
                         } else {} // 攀爬状态不做处理
                     }
                 } else {
                     // 检测下方斜坡瓦片
                     auto width_left = obj_pos.x - tile_x * tile_size.x;
                     auto width_right = obj_pos.x + obj_size.x - tile_x_right * tile_size.x;
-                    auto height_left = getTileHeightAtWidth(width_left, tile_type_left, tile_size);
-                    auto height_right = getTileHeightAtWidth(width_right, tile_type_right, tile_size);
+                    auto height_left = view.slopeHeightAt(tile_type_left, width_left);
+                    auto height_right = view.slopeHeightAt(tile_type_right, width_right);
                     auto height = std::max(height_left, height_right);  // 取左右两边的最高点进行检测
                     if (height > 0.0f) {
                         if (new_obj_pos.y > (tile_y + 1) * layer->getTileSize().y - obj_size.y - height) {
                             new_obj_pos.y = (tile_y + 1) * layer->getTileSize().y - obj_size.y - height;
-                            pc->velocity_.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
-                            pc->setCollidedBelow(true);
+                            velocity.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
+                            bodies_.setFlag(index, BodyFlags::COLLIDED_BELOW, true);
                         }
                     }
                 }
@@ -246,170 +791,421 @@ namespace engine::physics {
                 auto top_left_y = new_obj_pos.y;
                 auto tile_y = static_cast<int>(floor(top_left_y / tile_size.y));   // 获取y方向瓦片坐标
                 auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));       // 获取x方向瓦片左上坐标
-                auto tile_type_left = layer->getTileTypeAt({tile_x, tile_y});
+                auto tile_type_left = view.typeAt(tile_x, tile_y);
                 auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));   // 获取x方向瓦片右上坐标
-                auto tile_type_right = layer->getTileTypeAt({tile_x_right, tile_y});
+                auto tile_type_right = view.typeAt(tile_x_right, tile_y);
 
                 if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID) {
-                    pc->velocity_.y = 0.0f;
+                    velocity.y = 0.0f;
                     new_obj_pos.y = (tile_y + 1) * tile_size.y;
-                    pc->setCollidedAbove(true);
+                    bodies_.setFlag(index, BodyFlags::COLLIDED_ABOVE, true);
                 }
             }
         }
-        // 更新对象位置，并限制最大速度
+        // 更新对象位置（最大速度已在积分时限制）
+        position += new_obj_pos - obj_pos; // 使用平移，避免直接设置位置，因为碰撞盒可能有偏移量
+    }
+
+    bool PhysicsEngine::resolveSolidObjectCollision(size_t move_index, size_t solid_index, const collision::Contact &contact)
+    {
+        // 只有动态刚体会被 SOLID 推挤
+        if (bodies_.type_[move_index] != BodyType::DYNAMIC) return false;
+        if (contact.overlap.x < 0.1f && contact.overlap.y < 0.1f) return false; // 重叠部分太小，则认为没有碰撞
+
+        // 沿接触法线反方向移出穿透深度（最小平移向量）
+        translateBody(move_index, -contact.normal * contact.penetration);
+
+        // 朝 SOLID 运动时去掉法线方向的速度，并按法线的主轴记录碰撞方向
+        auto& move_velocity = bodies_.velocity_[move_index];
+        if (glm::dot(move_velocity, contact.normal) > 0.0f) {
+            move_velocity -= contact.normal * glm::dot(move_velocity, contact.normal);
+            if (std::abs(contact.normal.x) > std::abs(contact.normal.y)) {
+                bodies_.setFlag(move_index, contact.normal.x > 0.0f ? BodyFlags::COLLIDED_RIGHT : BodyFlags::COLLIDED_LEFT, true);
+            } else {
+                bodies_.setFlag(move_index, contact.normal.y > 0.0f ? BodyFlags::COLLIDED_BELOW : BodyFlags::COLLIDED_ABOVE, true);
+            }
+        }
+        // 休眠刚体被移动的 SOLID（如运动学平台）推挤时唤醒
+        if (bodies_.hasFlag(move_index, BodyFlags::SLEEPING)) deferWake(move_index);
 
-        tc->translate(new_obj_pos - obj_pos); // 使用 translate 方法，避免直接设置位置，因为碰撞盒可能有偏移量
-        pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
+        // 站在运动学 SOLID 上（法线朝下）：记录承载关系，之后每步随它一起移动，不再靠推挤跟随
+        if (bodies_.type_[solid_index] == BodyType::KINEMATIC && contact.normal.y > std::abs(contact.normal.x)) {
+            auto& carrier = bodies_.carrier_[move_index];
+            if (carrier == INVALID_BODY_HANDLE) riders_.push_back(bodies_.handleOf(move_index));
+            carrier = bodies_.handleOf(solid_index);
+            bodies_.setFlag(move_index, BodyFlags::CARRIER_CONTACT, true);
+        }
+        return true;
     }
 
-    void PhysicsEngine::resolveSolidObjectCollision(engine::object::GameObject *move_obj, engine::object::GameObject *solid_obj)
+    void PhysicsEngine::carryRiders(float delta_time)
     {
-        auto* move_tc = move_obj->getComponent<engine::component::TransformComponent>();
-        auto* move_pc = move_obj->getComponent<engine::component::PhysicsComponent>();
-        auto* move_cc = move_obj->getComponent<engine::component::ColliderComponent>();
-        auto* solid_cc = solid_obj->getComponent<engine::component::ColliderComponent>();
+        for (auto handle : riders_) {
+            const auto index = bodies_.indexOf(handle);
+            const auto carrier = bodies_.indexOf(bodies_.carrier_[index]);
+            // 承载体被改为其他类型或被禁用时不再带动乘客（关系保留到乘客离开）
+            if (bodies_.type_[carrier] != BodyType::KINEMATIC || bodies_.type_[index] != BodyType::DYNAMIC) continue;
+            if ((bodies_.flags_[carrier] & (BodyFlags::SIMULATED | BodyFlags::DORMANT)) != BodyFlags::SIMULATED ||
+                (bodies_.flags_[index] & (BodyFlags::SIMULATED | BodyFlags::DORMANT)) != BodyFlags::SIMULATED) continue;
 
-        // 这里只获取期望位置，无法获取当前帧初始位置，无法进行轴分离碰撞检测
-        auto move_aabb = move_cc->getWorldAABB();
-        auto solid_aabb = solid_cc->getWorldAABB();
+            // 与承载体在本步的移动量相同（运动学刚体只按速度移动）
+            const auto offset = bodies_.velocity_[carrier] * (delta_time * bodies_.step_scale_[carrier]);
+            if (offset == glm::vec2(0.0f)) continue;
+            if (bodies_.hasFlag(index, BodyFlags::SLEEPING)) bodies_.wake(index);
+            bodies_.carry_offset_[index] = offset;
+        }
+    }
 
-        // 使用最小平移向量解决碰撞问题
-        auto move_center = move_aabb.position + move_aabb.size / 2.0f;
-        auto solid_center = solid_aabb.position + solid_aabb.size / 2.0f;
-        auto overlap = glm::vec2(move_aabb.size/2.0f + solid_aabb.size/2.0f) - glm::abs(move_center - solid_center);
-        if (overlap.x < 0.1f && overlap.y < 0.1f) return; // 重叠部分太小，则认为没有碰撞
+    void PhysicsEngine::updateRiders()
+    {
+        size_t kept = 0;
+        for (auto handle : riders_) {
+            const auto index = bodies_.indexOf(handle);
+            const bool touched = bodies_.hasFlag(index, BodyFlags::CARRIER_CONTACT);
+            bodies_.setFlag(index, BodyFlags::CARRIER_CONTACT, false);
+            // 休眠中的乘客不会再与承载体接触（没有重力带来的穿透），保留关系，承载体移动时由 carryRiders 唤醒；冻结的乘客同样保留
+            if (!touched && !bodies_.hasFlag(index, BodyFlags::INACTIVE)) {
+                bodies_.carrier_[index] = INVALID_BODY_HANDLE;
+                continue;
+            }
+            riders_[kept++] = handle;
+        }
+        riders_.resize(kept);
+    }
 
-        if (overlap.x < overlap.y) { // X轴重叠更多，优先解决X轴碰撞
-            if (move_center.x < solid_center.x) {
-                move_tc->translate(glm::vec2(-overlap.x, 0.0f));
-                if (move_pc->velocity_.x > 0.0f)
-                {
-                    move_pc->velocity_.x = 0.0f;
-                    move_pc->setCollidedRight(true);
-                }
-            } else { //
-                move_tc->translate(glm::vec2(overlap.x, 0.0f));
-                if (move_pc->velocity_.x < 0.0f)
-                {
-                    move_pc->velocity_.x = 0.0f;
-                    move_pc->setCollidedLeft(true);
+    void PhysicsEngine::removeRiderLinks(BodyHandle handle)
+    {
+        auto it = std::remove_if(riders_.begin(), riders_.end(), [this, handle](BodyHandle rider) {
+            auto& carrier = bodies_.carrier_[bodies_.indexOf(rider)];
+            if (rider != handle && carrier != handle) return false;
+            carrier = INVALID_BODY_HANDLE;
+            return true;
+        });
+        riders_.erase(it, riders_.end());
+    }
+
+    void PhysicsEngine::translateBody(size_t index, const glm::vec2 &offset)
+    {
+        bodies_.position_[index] += offset;
+        bodies_.transform_[index]->translate(offset);
+    }
+
+    bool PhysicsEngine::sweepBulletTiles(size_t index, glm::vec2 obj_pos, const glm::vec2 &obj_size, glm::vec2 motion)
+    {
+        auto& velocity = bodies_.velocity_[index];
+        const auto start_pos = obj_pos;
+        bool swept_hit = false;
+        TileSweepHit hit;
+        TileSweepHit layer_hit;
+        for (int pass = 0; pass < MAX_SWEEP_PASSES && (motion.x != 0.0f || motion.y != 0.0f); ++pass) {
+            // 所有碰撞层中最早的命中
+            bool found = false;
+            for (auto* layer : collision_tile_layers_) {
+                if (!layer) continue;
+                if (layer->getCollisionView().sweepAABB(obj_pos, obj_size, motion, layer_hit) && (!found || layer_hit.time < hit.time)) {
+                    hit = layer_hit;
+                    found = true;
                 }
             }
-        } else { // Y轴重叠更多，优先解决Y轴碰撞
-            if (move_center.y < solid_center.y) {
-                move_tc->translate(glm::vec2(0.0f, -overlap.y));
-                if (move_pc->velocity_.y > 0.0f)
-                {
-                    move_pc->velocity_.y = 0.0f;
-                    move_pc->setCollidedBelow(true);
-                }
+            if (!found) {
+                obj_pos += motion;
+                break;
             }
-            else {
-                move_tc->translate(glm::vec2(0.0f, overlap.y));
-                if (move_pc->velocity_.y < 0.0f)
-                {
-                    move_pc->velocity_.y = 0.0f;
-                    move_pc->setCollidedAbove(true);
-                }
+
+            swept_hit = true;
+            obj_pos = hit.position;
+            motion *= 1.0f - hit.time;
+            // 去掉朝向瓦片的分量，剩余位移沿表面滑动
+            const float motion_into = glm::dot(motion, hit.normal);
+            if (motion_into < 0.0f) motion -= hit.normal * motion_into;
+            const float velocity_into = glm::dot(velocity, hit.normal);
+            if (velocity_into < 0.0f) velocity -= hit.normal * velocity_into;
+            // 按法线的主方向设置碰撞标志（斜坡算作地面或天花板）
+            if (std::abs(hit.normal.y) >= std::abs(hit.normal.x)) {
+                bodies_.setFlag(index, hit.normal.y < 0.0f ? BodyFlags::COLLIDED_BELOW : BodyFlags::COLLIDED_ABOVE, true);
+            } else {
+                bodies_.setFlag(index, hit.normal.x < 0.0f ? BodyFlags::COLLIDED_RIGHT : BodyFlags::COLLIDED_LEFT, true);
             }
         }
+        if (!swept_hit) return false;
+        bodies_.position_[index] += obj_pos - start_pos;    // 使用平移，因为碰撞盒可能有偏移量
+        return true;
     }
 
-    void PhysicsEngine::applyWorldBounds(engine::component::PhysicsComponent *pc)
+    void PhysicsEngine::applyWorldBounds(size_t index)
     {
-        if (!pc || !world_bounds_) return;
+        if (!world_bounds_ || !bodies_.hasFlag(index, BodyFlags::HAS_COLLIDER)) return;
 
         // 只限定左、上、右边界，不限定下边界，以碰撞盒作为判断依据
-        auto* obj = pc->getOwner();
-        auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-        auto* tc = obj->getComponent<engine::component::TransformComponent>();
-        auto world_aabb = cc->getWorldAABB();
+        auto& velocity = bodies_.velocity_[index];
+        auto world_aabb = getBodyAABB(index);
         auto obj_pos = world_aabb.position;
         auto obj_size = world_aabb.size;
 
         if (obj_pos.x < world_bounds_->position.x){
-            pc->velocity_.x = 0.0f;
+            velocity.x = 0.0f;
             obj_pos.x = world_bounds_->position.x;
         }
         if (obj_pos.y < world_bounds_->position.y){
-            pc->velocity_.y = 0.0f;
+            velocity.y = 0.0f;
             obj_pos.y = world_bounds_->position.y;
         }
         if (obj_pos.x + obj_size.x > world_bounds_->position.x + world_bounds_->size.x){
-            pc->velocity_.x = 0.0f;
+            velocity.x = 0.0f;
             obj_pos.x = world_bounds_->position.x + world_bounds_->size.x - obj_size.x;
         }
 
-        tc->translate(obj_pos - world_aabb.position);
+        bodies_.position_[index] += obj_pos - world_aabb.position;
     }
 
-    float PhysicsEngine::getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tile_size)
+    void PhysicsEngine::checkTileTriggers()
     {
-        auto rel_x = glm::clamp(width / tile_size.x, 0.0f, 1.0f);
-        switch (type)
-        {
-            case engine::component::TileType::SLOPE_0_1:    // 斜坡 0-1
-                return rel_x * tile_size.y;
-            case engine::component::TileType::SLOPE_0_2:    // 斜坡 0-2
-                return rel_x * tile_size.y * 0.5f;
-            case engine::component::TileType::SLOPE_2_1:    // 斜坡 2-1
-                return rel_x * tile_size.y * 0.5f + tile_size.y * 0.5f;
-            case engine::component::TileType::SLOPE_1_0:    // 斜坡 1-0
-                return (1.0f - rel_x) * tile_size.y;
-            case engine::component::TileType::SLOPE_2_0:    // 斜坡 2-0
-                return (1.0f - rel_x) * tile_size.y * 0.5f;
-            case engine::component::TileType::SLOPE_1_2:    // 斜坡 1-2
-                return (1.0f - rel_x) * tile_size.y * 0.5f + tile_size.y * 0.5f;
-            default:
-                return 0.0f;        // 默认返回0.表示没有斜坡
+        const auto ladder_bit = tileTypeBit(engine::component::TileType::LADDER);
+        // 各块的事件写入各自的缓冲，按块顺序合并后与串行的顺序相同
+        const auto chunk_count = forEachRange(bodies_.size(), [this, ladder_bit](size_t begin, size_t end, size_t chunk) {
+            auto& events = chunk_trigger_events_[chunk];
+            events.clear();
+            for (size_t i = begin; i < end; ++i){
+                const TileTypeMask previous = bodies_.tile_triggers_[i];
+                TileTypeMask current = 0;
+                // 不参与碰撞的刚体、触发器与静态刚体不会接触触发瓦片（之前的接触产生离开事件）
+                if (isCollidable(i) && !bodies_.hasFlag(i, BodyFlags::TRIGGER) && bodies_.type_[i] != BodyType::STATIC) {
+                    if (bodies_.hasFlag(i, BodyFlags::INACTIVE)) {
+                        current = previous;     // 休眠/冻结的刚体没有移动，接触状态不变
+                    } else {
+                        current = scanTileTriggers(i);
+                    }
+                }
+                if ((previous | current) == 0) continue;
+                bodies_.tile_triggers_[i] = current;
+
+                // 梯子由物理引擎自己处理，同时也会产生事件
+                if (current & ladder_bit) bodies_.setFlag(i, BodyFlags::COLLIDED_LADDER, true);
+
+                auto* obj = bodies_.component_[i]->getOwner();
+                if (!obj) continue;
+                // 按类型取值从小到大生成事件
+                for (unsigned bits = previous | current; bits != 0; bits &= bits - 1) {
+                    const unsigned bit = bits & (~bits + 1);
+                    const auto type = static_cast<engine::component::TileType>(std::countr_zero(bits));
+                    const auto phase = !(previous & bit) ? TileTriggerPhase::ENTER :
+                                       (current & bit) ? TileTriggerPhase::STAY : TileTriggerPhase::EXIT;
+                    events.push_back(TileTriggerEvent{obj, type, phase});
+                    spdlog::trace("Tile trigger event: obj={}, type={}, phase={}", obj->getName(), static_cast<int>(type), static_cast<int>(phase));
+                }
+            }
+        });
+
+        for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+            tile_trigger_events_.insert(tile_trigger_events_.end(), chunk_trigger_events_[chunk].begin(), chunk_trigger_events_[chunk].end());
         }
     }
 
-    void PhysicsEngine::checkTileTriggers()
+    TileTypeMask PhysicsEngine::scanTileTriggers(size_t index) const
     {
-        for (auto* pc : components_){
-            if (!pc || !pc->isEnable()) continue;
-            auto* obj = pc->getOwner();
-            if (!obj) continue;
-            auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-            if (!cc || !cc->isActive() || cc->isTrigger()) continue;
+        constexpr float tolerance = 1.0f;   // 检测右边缘和下边缘时，需要减1像素，否则会检测到下一行/列的瓦片
+        const auto world_aabb = getBodyAABB(index);
+        TileTypeMask mask = 0;
+        for (auto* layer : collision_tile_layers_){
+            if (!layer) continue;
+            const auto& view = layer->getCollisionView();
+            if (!view.hasTriggers()) continue;
+            auto tile_size = layer->getTileSize();
 
-            auto world_aabb = cc->getWorldAABB();
+            // 获取瓦片坐标范围
+            auto start_x = static_cast<int>(floor(world_aabb.position.x / tile_size.x));
+            auto start_y = static_cast<int>(floor(world_aabb.position.y / tile_size.y));
+            auto end_x = static_cast<int>(ceil((world_aabb.position.x + world_aabb.size.x - tolerance) / tile_size.x));
+            auto end_y = static_cast<int>(ceil((world_aabb.position.y + world_aabb.size.y - tolerance) / tile_size.y));
 
-            std::set<engine::component::TileType> triggers_set;
+            mask = static_cast<TileTypeMask>(mask | view.queryTriggers(start_x, start_y, end_x, end_y));
+        }
+        return mask;
+    }
 
-            for (auto* layer:collision_tile_layers_){
-                if (!layer) continue;
-                auto tile_size = layer->getTileSize();
-                constexpr float tolerance = 1.0f;   // 检测右边缘和下边缘时，需要减1像素，否则会检测到下一行/列的瓦片
-
-                // 获取瓦片坐标范围
-                auto start_x = static_cast<int>(floor(world_aabb.position.x / tile_size.x));
-                auto start_y = static_cast<int>(floor(world_aabb.position.y / tile_size.y));
-                auto end_x = static_cast<int>(ceil((world_aabb.position.x + world_aabb.size.x - tolerance) / tile_size.x));
-                auto end_y = static_cast<int>(ceil((world_aabb.position.y + world_aabb.size.y - tolerance) / tile_size.y));
-
-                for (int x = start_x; x < end_x; ++x){
-                    for (int y = start_y; y < end_y; ++y){
-                        auto tile_type = layer->getTileTypeAt({x, y});
-                        // TODO: 添加更多触发器类型
-                        if (tile_type  == engine::component::TileType::HAZARD){
-                            triggers_set.insert(tile_type);
-                        }
-                        // 梯子类型不用记录到事件容器，物理引擎自己处理
-                        else if (tile_type == engine::component::TileType::LADDER){
-                            pc->setCollidedLadder(true);
-                        }
-                    }
-                }
+    std::optional<RaycastHit> PhysicsEngine::raycastTiles(const glm::vec2 &origin, const glm::vec2 &direction, float max_distance, TileTypeMask tile_types) const
+    {
+        const float length = glm::length(direction);
+        if (length <= 0.0f || !(max_distance >= 0.0f) || !std::isfinite(max_distance)) return std::nullopt;
+        const glm::vec2 dir = direction / length;
 
-                for (const auto& type : triggers_set){
-                    tile_trigger_events_.emplace_back(obj, type);
-                    spdlog::trace("Tile trigger event: obj={}, type={}", obj->getName(), static_cast<int>(type));
+        std::optional<RaycastHit> best;
+        RaycastHit hit;
+        for (auto* layer : collision_tile_layers_) {
+            if (!layer) continue;
+            const float limit = best ? best->distance : max_distance;
+            if (layer->getCollisionView().raycast(origin, dir, limit, tile_types, hit) && (!best || hit.distance < best->distance)) {
+                best = hit;
+            }
+        }
+        return best;
+    }
+
+    std::optional<RaycastHit> PhysicsEngine::raycastColliders(const glm::vec2 &origin, const glm::vec2 &direction, float max_distance, const QueryFilter &filter)
+    {
+        const float length = glm::length(direction);
+        if (length <= 0.0f || !(max_distance >= 0.0f) || !std::isfinite(max_distance) || bodies_.empty()) return std::nullopt;
+        const glm::vec2 dir = direction / length;
+        rebuildQueryGrid();
+        if (query_grid_.empty() && static_grid_.empty()) return std::nullopt;
+
+        // 只遍历有碰撞器的范围：射线先裁剪到两个结构中所有包围盒的并集，离开该范围即结束
+        glm::vec2 region_min = query_grid_.getBoundsMin();
+        glm::vec2 region_max = query_grid_.getBoundsMax();
+        if (!static_grid_.empty()) {
+            region_min = glm::min(region_min, static_grid_.getBoundsMin());
+            region_max = glm::max(region_max, static_grid_.getBoundsMax());
+        }
+        float t_enter = 0.0f;
+        glm::vec2 enter_normal;
+        if (!collision::intersectRayAABB(origin, dir, max_distance, {region_min, region_max - region_min}, t_enter, enter_normal)) {
+            return std::nullopt;
+        }
+        double t_leave = max_distance;
+        for (int axis = 0; axis < 2; ++axis) {
+            if (dir[axis] == 0.0f) continue;
+            t_leave = std::min(t_leave, static_cast<double>((dir[axis] > 0.0f ? region_max[axis] : region_min[axis]) - origin[axis]) / dir[axis]);
+        }
+
+        // 从进入范围处开始沿射线按网格 DDA 遍历，每格查询动态与静态结构；命中点不晚于离开当前格时即可结束。
+        // 网格坐标与 UniformGrid 一样限制在 ±MAX_RAYCAST_CELL_COORD 内（更远的包围盒都记录在边界格中），到达边界格后该轴不再前进；
+        // 越过网格线的时间由格子坐标直接算出（double），不累加步长，保证每前进一格时间都严格递增
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        const float cell_size = query_grid_.getCellSize();
+        glm::ivec2 cell = glm::ivec2(glm::clamp(glm::floor((origin + dir * t_enter) / cell_size), -MAX_RAYCAST_CELL_COORD, MAX_RAYCAST_CELL_COORD));
+        const glm::ivec2 step = {dir.x > 0.0f ? 1 : (dir.x < 0.0f ? -1 : 0), dir.y > 0.0f ? 1 : (dir.y < 0.0f ? -1 : 0)};
+        const auto next_crossing = [&](int axis) {
+            if (step[axis] == 0 || cell[axis] * step[axis] >= static_cast<int>(MAX_RAYCAST_CELL_COORD)) return infinity;
+            const double boundary = static_cast<double>(cell[axis] + (step[axis] > 0 ? 1 : 0)) * cell_size;
+            return (boundary - origin[axis]) / dir[axis];
+        };
+        glm::dvec2 t_max = {next_crossing(0), next_crossing(1)};
+
+        std::optional<size_t> best_index;
+        float best_distance = max_distance;
+        glm::vec2 best_normal = {0.0f, 0.0f};
+        while (true) {
+            // 以格子中心的小矩形查询，只命中这一格的记录
+            const engine::utils::Rect cell_rect{(glm::vec2(cell) + 0.25f) * cell_size, glm::vec2(cell_size * 0.5f)};
+            collectQueryCandidates(cell_rect);
+            for (auto i : query_candidates_) {
+                if (!passesQueryFilter(i, filter)) continue;
+                float distance = 0.0f;
+                glm::vec2 normal;
+                if (intersectRayBody(i, origin, dir, best_distance, distance, normal) &&
+                    (!best_index || distance < best_distance || (distance == best_distance && i < *best_index))) {
+                    best_index = i;
+                    best_distance = distance;
+                    best_normal = normal;
                 }
             }
+            const double t_exit = std::min(t_max.x, t_max.y);
+            if ((best_index && best_distance <= t_exit) || t_exit > t_leave) break;
+            const int axis = t_max.x < t_max.y ? 0 : 1;
+            cell[axis] += step[axis];
+            t_max[axis] = next_crossing(axis);
+        }
+
+        if (!best_index) return std::nullopt;
+        RaycastHit hit;
+        hit.object = bodies_.component_[*best_index]->getOwner();
+        hit.point = origin + dir * best_distance;
+        hit.normal = best_normal;
+        hit.distance = best_distance;
+        return hit;
+    }
+
+    std::optional<RaycastHit> PhysicsEngine::raycast(const glm::vec2 &origin, const glm::vec2 &direction, float max_distance, const QueryFilter &filter, TileTypeMask tile_types)
+    {
+        auto tile_hit = raycastTiles(origin, direction, max_distance, tile_types);
+        // 碰撞器只需检测到瓦片命中点为止
+        auto collider_hit = raycastColliders(origin, direction, tile_hit ? tile_hit->distance : max_distance, filter);
+        if (collider_hit && (!tile_hit || collider_hit->distance < tile_hit->distance)) return collider_hit;
+        return tile_hit;
+    }
+
+    size_t PhysicsEngine::queryAABB(const engine::utils::Rect &aabb, std::vector<engine::object::GameObject *> &out_objects, const QueryFilter &filter)
+    {
+        if (bodies_.empty()) return 0;
+        rebuildQueryGrid();
+        collectQueryCandidates(aabb);
+        const auto begin = out_objects.size();
+        for (auto i : query_candidates_) {
+            if (!passesQueryFilter(i, filter)) continue;
+            const auto body_aabb = getBodyAABB(i);
+            if (!collision::checkRectOverlap(aabb, body_aabb)) continue;
+            // 圆形碰撞器再检测矩形上距圆心最近的点
+            if (bodies_.collider_[i]->getCollider()->getType() == ColliderType::CIRCLE) {
+                const auto center = body_aabb.position + 0.5f * body_aabb.size;
+                const auto nearest_point = glm::clamp(center, aabb.position, aabb.position + aabb.size);
+                if (!collision::checkPointInCircle(nearest_point, center, 0.5f * body_aabb.size.x)) continue;
+            }
+            out_objects.push_back(bodies_.component_[i]->getOwner());
+        }
+        return out_objects.size() - begin;
+    }
+
+    size_t PhysicsEngine::queryPoint(const glm::vec2 &point, std::vector<engine::object::GameObject *> &out_objects, const QueryFilter &filter)
+    {
+        if (bodies_.empty()) return 0;
+        rebuildQueryGrid();
+        collectQueryCandidates({point, {0.0f, 0.0f}});
+        const auto begin = out_objects.size();
+        for (auto i : query_candidates_) {
+            if (!passesQueryFilter(i, filter)) continue;
+            const auto body_aabb = getBodyAABB(i);
+            const auto body_max = body_aabb.position + body_aabb.size;
+            if (point.x < body_aabb.position.x || point.y < body_aabb.position.y || point.x > body_max.x || point.y > body_max.y) continue;
+            if (bodies_.collider_[i]->getCollider()->getType() == ColliderType::CIRCLE &&
+                !collision::checkPointInCircle(point, body_aabb.position + 0.5f * body_aabb.size, 0.5f * body_aabb.size.x)) continue;
+            out_objects.push_back(bodies_.component_[i]->getOwner());
+        }
+        return out_objects.size() - begin;
+    }
+
+    void PhysicsEngine::rebuildQueryGrid()
+    {
+        if (!query_grid_dirty_) return;
+        query_grid_.clear();
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            if (isCollidable(i) && bodies_.type_[i] != BodyType::STATIC) {
+                query_grid_.insert(bodies_.handleOf(i), getBodyAABB(i));
+            }
+        }
+        query_grid_.build();
+        query_grid_dirty_ = false;
+    }
+
+    void PhysicsEngine::collectQueryCandidates(const engine::utils::Rect &aabb)
+    {
+        query_candidates_.clear();
+        query_grid_.query(aabb, query_candidates_);
+        static_grid_.query(aabb, query_candidates_);
+        // 两个结构中保存的都是句柄；查询之间可能有刚体被删除，先剔除失效句柄再换算为稠密下标
+        std::erase_if(query_candidates_, [this](std::uint32_t handle) { return !bodies_.isValid(handle); });
+        for (auto& id : query_candidates_) {
+            id = bodies_.indexOf(id);
+        }
+        std::sort(query_candidates_.begin(), query_candidates_.end());
+        query_candidates_.erase(std::unique(query_candidates_.begin(), query_candidates_.end()), query_candidates_.end());
+    }
+
+    bool PhysicsEngine::passesQueryFilter(size_t index, const QueryFilter &filter) const
+    {
+        if (!isCollidable(index) || (bodies_.collision_layer_[index] & filter.mask) == 0) return false;
+        if (!filter.include_triggers && bodies_.hasFlag(index, BodyFlags::TRIGGER)) return false;
+        return !filter.ignore || bodies_.component_[index]->getOwner() != filter.ignore;
+    }
+
+    bool PhysicsEngine::intersectRayBody(size_t index, const glm::vec2 &origin, const glm::vec2 &direction, float max_distance,
+                                         float &out_distance, glm::vec2 &out_normal) const
+    {
+        const auto body_aabb = getBodyAABB(index);
+        if (bodies_.collider_[index]->getCollider()->getType() == ColliderType::CIRCLE) {
+            return collision::intersectRayCircle(origin, direction, max_distance, body_aabb.position + 0.5f * body_aabb.size,
+                                                 0.5f * body_aabb.size.x, out_distance, out_normal);
         }
+        return collision::intersectRayAABB(origin, direction, max_distance, body_aabb, out_distance, out_normal);
     }
 
 }   // namespace engine::physics
\ No newline at end of file
@@ -2,10 +2,21 @@
 #include <vector>
 #include <glm/vec2.hpp>
 #include <optional>
+#include <cstdint>
+#include <functional>
+#include "body_storage.h"
+#include "broadphase.h"
+#include "uniform_grid.h"
+#include "sweep_and_prune.h"
+#include "contact_cache.h"
+#include "scene_query.h"
+#include "tile_collision_view.h"
+#include "world_partition.h"
 #include "../utils/math.h"
 
 namespace engine::component {
     class PhysicsComponent;
+    class ColliderComponent;
     class TileLayerComponent;
     enum class TileType;
 }
@@ -14,11 +25,15 @@ namespace engine::object {
     class GameObject;
 }
 
+namespace engine::core {
+    class ThreadPool;
+}
+
 namespace engine::physics {
 
 class PhysicsEngine {
 private:
-    std::vector<engine::component::PhysicsComponent*> components_;    // 注册过的物理组件容器，非拥有指针
+    BodyStorage bodies_;    // 所有刚体数据（结构数组），PhysicsComponent 只持有其中的句柄
     std::vector<engine::component::TileLayerComponent*> collision_tile_layers_;     // 注册过的 碰撞瓦片图层 容器
     glm::vec2 gravity_ = {0.0f, 980.0f};    // 默认重力值(像素/秒^2,相当于100像素对应于1米)
     float max_speed_ = 500.0f;    // 最大速度(像素/秒)
@@ -26,8 +41,59 @@ private:
 
     /// @brief 存储本帧发生的 GameObject 碰撞对 （每次 update 开始时清空）
     std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> collision_pairs_;
-    /// @brief 存储本帧发生的瓦片触发事件（每次 update 开始时清空）
-    std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>> tile_trigger_events_;
+    /// @brief 跨帧的物体接触缓存，生成开始/持续/结束事件
+    ContactCache contact_cache_;
+    /// @brief 存储本帧发生的瓦片触发事件（进入/停留/离开，每次 update 开始时清空）
+    std::vector<TileTriggerEvent> tile_trigger_events_;
+
+    // --- 宽阶段相关 ---
+    BroadphaseType broadphase_type_ = BroadphaseType::UNIFORM_GRID;   // 当前使用的宽阶段算法
+    bool validate_broadphase_ = false;      // 是否用暴力检测校验宽阶段结果（仅调试用，开销较大）
+    UniformGrid uniform_grid_;              // 均匀网格宽阶段
+    SweepAndPrune sweep_and_prune_;         // 排序扫描宽阶段
+    std::vector<std::uint64_t> candidate_pairs_;    // 宽阶段输出的候选对（刚体稠密下标对），帧间复用
+    std::vector<std::uint64_t> extra_pairs_;        // 窄阶段中因 SOLID 推挤而新增的候选对（小顶堆）
+    std::vector<size_t> moved_bodies_;              // 本帧被 SOLID 推挤过的物体下标
+    std::vector<std::uint32_t> query_buffer_;       // 网格查询的临时缓冲
+
+    // --- 静态刚体与休眠 ---
+    UniformGrid static_grid_;               // 静态刚体的加速结构（代理编号为刚体句柄），只在静态刚体集合变化时重建
+    bool static_dirty_ = true;              // 静态刚体被添加/删除/移动，需要重建 static_grid_
+    bool sleep_enabled_ = true;             // 是否允许动态刚体休眠
+    float sleep_velocity_threshold_ = 2.0f; // 速度低于此值（像素/秒）视为静止
+    float sleep_time_ = 0.5f;               // 持续静止多久（秒）后进入休眠
+    std::vector<size_t> deferred_wakes_;    // 物体间碰撞检测中需要唤醒的刚体（检测结束后统一唤醒，使各宽阶段的检测顺序一致）
+
+    // --- 承载（移动平台）---
+    std::vector<BodyHandle> riders_;        // 站在运动学承载体上的刚体（句柄），由窄阶段中的接触建立、未再接触时解除
+
+    // --- 空间查询 ---
+    UniformGrid query_grid_;                // 非静态刚体的查询结构（代理编号为刚体句柄），步进后首次查询时重建
+    bool query_grid_dirty_ = true;          // 刚体已移动，query_grid_ 需要重建
+    std::vector<std::uint32_t> query_candidates_;   // 查询的候选刚体（临时缓冲）
+    static constexpr float MAX_RAYCAST_CELL_COORD = 1 << 24;    // 射线遍历的网格坐标范围（与 UniformGrid 一致）
+
+    // --- 区块划分 ---
+    WorldPartition partition_;              // 世界区块划分（按瓦片尺寸的整数倍切分世界范围）
+    bool region_culling_ = false;           // 是否按区块距离相机的远近降低/停止模拟并处理离开世界的刚体
+    int chunk_tiles_ = 16;                  // 每个区块的边长（瓦片数）
+    std::uint32_t step_count_ = 0;          // 已执行的步数（用于错开降频模拟的刚体）
+    OutOfWorldPolicy out_of_world_policy_ = OutOfWorldPolicy::KEEP;   // 离开世界范围后的处理策略
+    float out_of_world_margin_ = 64.0f;     // 超出世界范围多远才算离开（像素）
+    std::vector<engine::object::GameObject*> out_of_world_objects_;     // 本步离开世界范围的游戏对象
+
+    // --- 确定性模式 ---
+    bool deterministic_ = false;            // 是否启用确定性模式（固定步长，结果只取决于输入序列）
+    float fixed_delta_time_ = 1.0f / 60.0f; // 确定性模式下每步使用的时间
+
+    // --- 并行步进 ---
+    engine::core::ThreadPool* thread_pool_ = nullptr;  // 工作线程池（非拥有），为空时串行执行
+    size_t parallel_min_batch_ = 64;        // 每个并行块最少处理的元素数
+    // 每个并行块各自的输出缓冲，执行完毕后按块编号顺序合并，结果与线程数无关
+    std::vector<std::vector<std::uint64_t>> chunk_pairs_;
+    std::vector<std::vector<TileTriggerEvent>> chunk_trigger_events_;
+    std::vector<std::vector<std::uint32_t>> chunk_query_buffers_;
+    std::vector<collision::PackedAABBs> chunk_scratch_;
 public:
     PhysicsEngine() = default;
 
@@ -36,8 +102,17 @@ public:
     PhysicsEngine(PhysicsEngine&&) = delete;
     PhysicsEngine& operator=(PhysicsEngine&&) = delete;
 
-    void registerComponent(component::PhysicsComponent* component);
-    void unregisterComponent(component::PhysicsComponent* component);
+    /**
+     * @brief 为物理组件创建刚体（在组件构造时调用）
+     *
+     * @return BodyHandle 刚体句柄
+     */
+    BodyHandle createBody(component::PhysicsComponent* component, bool use_gravity, float mass);
+    BodyStorage& getBodies() { return bodies_; }
+    const BodyStorage& getBodies() const { return bodies_; }
+
+    void registerComponent(component::PhysicsComponent* component);     // 绑定组件的 Transform/Collider，刚体开始参与模拟
+    void unregisterComponent(component::PhysicsComponent* component);   // 删除组件对应的刚体
 
     // 如果瓦片层需要进行碰撞检测则注册，不需要则不注册
     void registerCollisionTileLayer(component::TileLayerComponent* tile_layer);
@@ -49,38 +124,244 @@ public:
     const glm::vec2& getGravity() const { return gravity_; }
     void setMaxSpeed(float max_speed) { max_speed_ = max_speed; }
     float getMaxSpeed() const { return max_speed_; }
-    void setWorldBounds(const engine::utils::Rect& world_bounds) { world_bounds_ = world_bounds; }
+    void setWorldBounds(const engine::utils::Rect& world_bounds);   // 设置世界边界（同时作为区块划分的范围）
     const std::optional<engine::utils::Rect>& getWorldBounds() const { return world_bounds_; }
     const std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionPairs() const {
         return collision_pairs_;
     }
-    const std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>>& getTileTriggerEvents() const {
+    /// @brief 本帧的物体接触事件（开始/持续/结束），只需在状态变化时处理的逻辑应使用它代替 getCollisionPairs()
+    const std::vector<ContactEvent>& getContactEvents() const {
+        return contact_cache_.getEvents();
+    }
+    const std::vector<TileTriggerEvent>& getTileTriggerEvents() const {
         return tile_trigger_events_;
     }
 
+    /**
+     * @brief 设置工作线程池，启用并行步进（积分、瓦片碰撞、宽阶段与瓦片触发检测）
+     *
+     * 物体间的精确检测与推挤仍然串行执行；碰撞对与触发事件的顺序与串行时完全相同。
+     * @param thread_pool 线程池（非拥有，需比物理引擎存活更久），为空时恢复串行
+     */
+    void setThreadPool(engine::core::ThreadPool* thread_pool) { thread_pool_ = thread_pool; }
+    engine::core::ThreadPool* getThreadPool() const { return thread_pool_; }
+    void setParallelMinBatch(size_t min_batch) { parallel_min_batch_ = min_batch; }
+
+    /**
+     * @brief 启用区块模拟级别：每步按刚体所在区块与关注区域（setRegionFocus）的距离决定是否/以多低的频率模拟，
+     * 并按 setOutOfWorldPolicy 处理离开世界范围的刚体。静态刚体与 setAlwaysActive 的刚体不受影响。
+     *
+     * 区块尺寸为碰撞瓦片层的瓦片尺寸 * chunk_tiles，范围为世界边界（未设置时为碰撞瓦片层的范围）。
+     */
+    void setRegionCulling(bool enable);
+    bool isRegionCulling() const { return region_culling_; }
+    void setRegionFocus(const engine::utils::Rect& focus_rect) { partition_.setFocus(focus_rect); }   // 通常每步设为相机视野
+    /**
+     * @brief 设置区块参数
+     *
+     * @param chunk_tiles 区块边长（瓦片数）
+     * @param active_radius 距关注区域不超过该区块数时每步模拟
+     * @param reduced_radius 不超过该区块数时每 reduced_interval 步模拟一次，更远则冻结（小于 active_radius 时不降频，直接冻结）
+     * @param reduced_interval 降频模拟的间隔（步）
+     */
+    void setRegionParams(int chunk_tiles, int active_radius, int reduced_radius, int reduced_interval);
+    std::uint32_t getStepCount() const { return step_count_; }
+    void setOutOfWorldPolicy(OutOfWorldPolicy policy, float margin = 64.0f) { out_of_world_policy_ = policy; out_of_world_margin_ = margin; }
+    OutOfWorldPolicy getOutOfWorldPolicy() const { return out_of_world_policy_; }
+    /// @brief 本步离开世界范围（并已按策略处理）的游戏对象
+    const std::vector<engine::object::GameObject*>& getOutOfWorldObjects() const { return out_of_world_objects_; }
+    const WorldPartition& getWorldPartition() const { return partition_; }
+
+    /**
+     * @brief 设置确定性模式：每步都使用固定的 delta_time（忽略 update 传入的值），
+     * 同一程序在相同输入序列下的结果逐位一致，可用于回放与回归测试
+     *
+     * 步进中的遍历顺序只取决于刚体的创建/删除顺序，并行时各块的输出按块编号合并，与线程数无关。
+     * @param enabled 是否启用
+     * @param fixed_delta_time 每步的时间（秒）
+     */
+    void setDeterministic(bool enabled, float fixed_delta_time);
+    bool isDeterministic() const { return deterministic_; }
+    /// @brief 所有刚体状态（句柄、位置、速度、标志位）的 64 位散列，用于逐步比较两次模拟的结果（只含物理状态，不含生命值、AI、动画等）
+    std::uint64_t computeStateHash() const;
+
+    void setBroadphaseType(BroadphaseType type) { broadphase_type_ = type; }
+    BroadphaseType getBroadphaseType() const { return broadphase_type_; }
+    void setBroadphaseValidation(bool enable) { validate_broadphase_ = enable; }
+    bool isBroadphaseValidation() const { return validate_broadphase_; }
+    void setGridCellSize(float cell_size) {
+        uniform_grid_.setCellSize(cell_size);
+        static_grid_.setCellSize(cell_size);
+        query_grid_.setCellSize(cell_size);
+        static_dirty_ = true;
+        query_grid_dirty_ = true;
+    }
+    float getGridCellSize() const { return uniform_grid_.getCellSize(); }
+
+    /**
+     * @brief 修改刚体类型（静态刚体集合变化时，静态加速结构会在下一帧重建）
+     *
+     * @param handle 刚体句柄
+     * @param type 新的刚体类型
+     */
+    void setBodyType(BodyHandle handle, BodyType type);
+    void setSleepEnabled(bool enable);
+    bool isSleepEnabled() const { return sleep_enabled_; }
+    void setSleepVelocityThreshold(float threshold) { sleep_velocity_threshold_ = threshold; }
+    float getSleepVelocityThreshold() const { return sleep_velocity_threshold_; }
+    void setSleepTime(float seconds) { sleep_time_ = seconds; }
+    float getSleepTime() const { return sleep_time_; }
+    void wakeAllBodies();           // 唤醒所有休眠的刚体（如支撑物被移除时）
+    /// @brief 承载该刚体的运动学刚体（站在移动平台上时），否则返回 INVALID_BODY_HANDLE
+    BodyHandle getCarrier(BodyHandle handle) const {
+        return bodies_.isValid(handle) ? bodies_.carrier_[bodies_.indexOf(handle)] : INVALID_BODY_HANDLE;
+    }
+    size_t getRiderCount() const { return riders_.size(); }
+
+    // --- 空间查询：基于最近一次 update 结束时的刚体位置，经由网格加速，不会线性遍历所有刚体 ---
+    /**
+     * @brief 射线与碰撞瓦片层求交（网格 DDA）
+     *
+     * @param origin 射线起点
+     * @param direction 射线方向（无需归一化）
+     * @param max_distance 最大检测距离（须为有限的非负数，否则视为未命中）
+     * @param tile_types 阻挡射线的瓦片类型，默认只有 SOLID（地面检测可使用 TileCollisionView::getGroundTileTypes()）
+     * @return std::optional<RaycastHit> 最近的命中，未命中返回 std::nullopt
+     */
+    std::optional<RaycastHit> raycastTiles(const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                                           TileTypeMask tile_types = TileCollisionView::getSolidTileTypes()) const;
+    /// @brief 射线与碰撞器求交（沿射线遍历宽阶段网格），参数含义同 raycastTiles
+    std::optional<RaycastHit> raycastColliders(const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                                               const QueryFilter& filter = {});
+    /// @brief 射线与瓦片、碰撞器求交，返回两者中最近的命中
+    std::optional<RaycastHit> raycast(const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                                      const QueryFilter& filter = {},
+                                      TileTypeMask tile_types = TileCollisionView::getSolidTileTypes());
+    /**
+     * @brief 查询与包围盒重叠的碰撞器
+     *
+     * @param aabb 世界坐标下的包围盒
+     * @param out_objects 输出容器（追加写入，不清空；按刚体顺序排列，不重复）
+     * @return size_t 本次追加的数量
+     */
+    size_t queryAABB(const engine::utils::Rect& aabb, std::vector<engine::object::GameObject*>& out_objects, const QueryFilter& filter = {});
+    /// @brief 查询包含指定点的碰撞器，输出约定同 queryAABB
+    size_t queryPoint(const glm::vec2& point, std::vector<engine::object::GameObject*>& out_objects, const QueryFilter& filter = {});
+
 private:
+    void gatherBodies();            // 从 Transform/Collider 收集本帧的位置、包围盒与碰撞器状态
+    void integrateBodies(float delta_time);     // 对所有刚体进行速度积分（连续数组上的紧凑循环）
+    void writeBackPositions();      // 将位移后的位置写回 TransformComponent
+    void updateSleeping(float delta_time);      // 累计动态刚体的静止时间，达到阈值后休眠
+    void updateRegions();           // 按所在区块设置本步的模拟级别（DORMANT 标志与时间倍率），处理离开世界的刚体
+    void rebuildPartition();        // 按世界边界与碰撞瓦片层重新划分区块
+    /**
+     * @brief 将各承载体本步的位移批量施加给站在其上的刚体（积分之前，只遍历 riders_）
+     *
+     * 位移写入 carry_offset_，与刚体自身的位移一起进行瓦片碰撞检测，不会被带进墙里；
+     * 承载体移动时唤醒休眠中的乘客。
+     */
+    void carryRiders(float delta_time);
+    void updateRiders();            // 解除本步未再站在承载体上的承载关系（休眠中的乘客保留）
+    void removeRiderLinks(BodyHandle handle);   // 删除刚体时解除与其有关的承载关系
+    void rebuildStaticGrid();       // 重建静态刚体的加速结构
+    void addStaticCandidatePairs(); // 活动刚体查询静态加速结构，补充与静态刚体的候选对
+    /**
+     * @brief 将 [0, count) 切分为连续的块执行（有线程池时并行），返回块数
+     *
+     * task 的参数为 (begin, end, chunk)，chunk 可用于访问各块的输出缓冲（chunk_pairs_ 等）。
+     */
+    size_t forEachRange(size_t count, const std::function<void(size_t, size_t, size_t)>& task);
+    void mergeChunkPairs(size_t chunk_count);   // 将各块的候选对按块顺序追加到 candidate_pairs_
     void checkObjectCollision();    // 物体间碰撞检测
-    void resolveTileCollision(engine::component::PhysicsComponent* pc, float delta_time);   // 检测并处理游戏对象和瓦片层之间的碰撞
-    void resolveSolidObjectCollision(engine::object::GameObject* move_obj, engine::object::GameObject* solid_obj);   // 检测可移动物体与SOLID物体的碰撞
-
-    void applyWorldBounds(engine::component::PhysicsComponent* pc);    // 应用世界边界，限制物体移动范围
+    void generateCandidatePairs();  // 根据宽阶段算法生成候选对（写入 candidate_pairs_）
+    void validateCandidatePairs() const;    // 用暴力检测校验候选对是否遗漏（调试用）
+    /**
+     * @brief 对一个候选对进行精确检测与处理
+     *
+     * @return std::optional<size_t> 若有物体被 SOLID 推挤而移动，返回其下标
+     */
+    std::optional<size_t> processObjectPair(size_t index_a, size_t index_b);
+    /**
+     * @brief 物体在窄阶段中被推挤后，补充它在新位置上的候选对（仅补充排在当前对之后的），保证结果与暴力检测一致
+     *
+     * @param index 被移动物体的下标
+     * @param current_key 当前正在处理的候选对
+     */
+    void addCandidatesForMovedBody(size_t index, std::uint64_t current_key);
+    void queryBroadphase(const engine::utils::Rect& aabb, std::vector<std::uint32_t>& out_ids) const;   // 按当前宽阶段查询包围盒附近的物体
+    void appendStaticQuery(const engine::utils::Rect& aabb, std::vector<std::uint32_t>& out_ids) const;  // 查询包围盒附近的静态刚体（输出稠密下标）
+    void resolveTileCollision(size_t index, float delta_time);   // 检测并处理刚体和瓦片层之间的碰撞（位置的更新也在此）
+    /**
+     * @brief 按接触信息将可移动物体推出 SOLID 物体，返回是否移动了物体
+     *
+     * 若 SOLID 物体是运动学刚体且位于可移动物体下方，则记录承载关系（见 carryRiders）。
+     * @param move_index 可移动物体
+     * @param solid_index SOLID 物体
+     * @param contact 以可移动物体为 a、SOLID 物体为 b 计算的接触信息
+     */
+    bool resolveSolidObjectCollision(size_t move_index, size_t solid_index, const collision::Contact& contact);
 
+    void applyWorldBounds(size_t index);    // 应用世界边界，限制物体移动范围
 
+    // --- 连续碰撞检测（高速物体） ---
     /**
-     * @brief 根据瓦片类型盒指定宽度x坐标，计算瓦片上对应的y坐标
+     * @brief 高速物体的连续碰撞：包围盒沿位移扫掠所有碰撞瓦片层，碰到瓦片时停在接触位置，
+     * 去掉朝向瓦片的速度与位移后沿表面继续扫掠剩余位移（最多 MAX_SWEEP_PASSES 次）
      *
-     * @param width 从瓦片左侧起算的宽度
-     * @param type 瓦片宽度
-     * @param tile_size 瓦片尺寸
-     * @return float 瓦片上对应的高度（从瓦片下侧起算）
+     * @return bool 路径上是否碰到瓦片（碰到时已更新位置、速度与碰撞标志）
      */
-    float getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tile_size);
+    bool sweepBulletTiles(size_t index, glm::vec2 obj_pos, const glm::vec2& obj_size, glm::vec2 motion);
+    static constexpr int MAX_SWEEP_PASSES = 2;  // 足以处理落地后滑行、贴墙下落等情况
+
+    void translateBody(size_t index, const glm::vec2& offset);  // 平移刚体，同时同步 TransformComponent（用于写回之后的推挤）
+
+    /// @brief 刚体是否参与物体间碰撞（启用、已绑定、拥有激活的碰撞器）
+    bool isCollidable(size_t index) const {
+        constexpr std::uint16_t mask = BodyFlags::SIMULATED | BodyFlags::HAS_COLLIDER | BodyFlags::COLLIDER_ACTIVE;
+        return (bodies_.flags_[index] & mask) == mask;
+    }
+    /// @brief 重置刚体的静止计时；若在休眠，则在物体间碰撞检测结束后唤醒
+    void deferWake(size_t index) {
+        bodies_.sleep_timer_[index] = 0.0f;
+        if (bodies_.hasFlag(index, BodyFlags::SLEEPING)) deferred_wakes_.push_back(index);
+    }
+    /// @brief 刚体是否处于静止状态（静态刚体、休眠或冻结中的刚体），两个静止刚体之间不需要检测
+    bool isBodyResting(size_t index) const {
+        return bodies_.type_[index] == BodyType::STATIC || bodies_.hasFlag(index, BodyFlags::INACTIVE);
+    }
+    /// @brief 两个刚体是否需要检测：碰撞层/掩码允许，且至少一方不处于静止状态
+    bool shouldBodiesCollide(size_t index_a, size_t index_b) const {
+        return shouldLayersCollide(bodies_.collision_layer_[index_a], bodies_.collision_mask_[index_a],
+                                   bodies_.collision_layer_[index_b], bodies_.collision_mask_[index_b]) &&
+               !(isBodyResting(index_a) && isBodyResting(index_b));
+    }
+    /// @brief 刚体碰撞器在世界坐标下的形状（基于本帧收集的数据）
+    collision::Shape getBodyShape(size_t index) const {
+        return {bodies_.shape_[index], getBodyAABB(index)};
+    }
+    /// @brief 刚体在世界坐标下的包围盒（基于本帧收集的数据）
+    engine::utils::Rect getBodyAABB(size_t index) const {
+        return {bodies_.position_[index] + bodies_.aabb_offset_[index], bodies_.aabb_size_[index]};
+    }
+
 
     /**
-     * @brief 检测所有游戏对象与瓦片层的触发类型瓦片碰撞，并记录触发事件。（位移处理完毕后再调用）
+     * @brief 检测所有游戏对象与瓦片层的触发类型瓦片碰撞，并与上一步比较生成进入/停留/离开事件。（位移处理完毕后再调用）
      *
+     * 只查询各瓦片层的触发瓦片稀疏索引，接触状态用位掩码累积，稳定状态下不产生堆分配。
      */
     void checkTileTriggers();
+    TileTypeMask scanTileTriggers(size_t index) const;  // 刚体包围盒覆盖的触发瓦片类型（所有瓦片层）
+
+    void rebuildQueryGrid();        // 按需重建空间查询结构
+    /// @brief 收集与包围盒位于相同网格的刚体（稠密下标，升序去重，写入 query_candidates_）
+    void collectQueryCandidates(const engine::utils::Rect& aabb);
+    /// @brief 刚体是否满足查询过滤条件
+    bool passesQueryFilter(size_t index, const QueryFilter& filter) const;
+    /// @brief 射线与刚体的碰撞器形状求交
+    bool intersectRayBody(size_t index, const glm::vec2& origin, const glm::vec2& direction, float max_distance,
+                          float& out_distance, glm::vec2& out_normal) const;
 
 };
 
@@ -0,0 +1,32 @@
+#pragma once
+#include "collision_layer.h"
+#include <glm/vec2.hpp>
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::component {
+    enum class TileType;
+}
+
+namespace engine::physics {
+
+/// @brief 空间查询的过滤条件
+struct QueryFilter {
+    CollisionMask mask = CollisionLayer::ALL;               // 只返回所属层与该掩码相交的碰撞器
+    const engine::object::GameObject* ignore = nullptr;     // 忽略的物体（通常为查询者自身）
+    bool include_triggers = true;                           // 是否包含触发器
+};
+
+/// @brief 射线检测的结果
+struct RaycastHit {
+    engine::object::GameObject* object = nullptr;           // 命中的物体（命中瓦片时为空）
+    engine::component::TileType tile_type{};                // 命中的瓦片类型（命中物体时为 EMPTY）
+    glm::ivec2 tile = {0, 0};                               // 命中的瓦片坐标（仅命中瓦片时有效）
+    glm::vec2 point = {0.0f, 0.0f};                         // 命中点（世界坐标）
+    glm::vec2 normal = {0.0f, 0.0f};                        // 命中面的法线（起点已在内部时为零向量）
+    float distance = 0.0f;                                  // 起点到命中点的距离
+};
+
+}   // namespace engine::physics
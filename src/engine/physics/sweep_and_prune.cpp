@@ -0,0 +1,128 @@
+#include "sweep_and_prune.h"
+#include "broadphase.h"
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace engine::physics {
+
+    void SweepAndPrune::beginUpdate(size_t count)
+    {
+        if (!dirty_ && proxies_.size() == count) return;
+
+        // 代理集合变化：按编号重建，稍后在 finishUpdate 中整体排序
+        proxies_.resize(count);
+        slot_of_.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            proxies_[i] = {0.0f, 0.0f, 0.0f, 0.0f, static_cast<std::uint32_t>(i), CollisionLayer::ALL, CollisionLayer::ALL, false};
+            slot_of_[i] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    void SweepAndPrune::setProxy(std::uint32_t id, const engine::utils::Rect &aabb, bool active, CollisionMask layer, CollisionMask mask)
+    {
+        auto& proxy = proxies_[slot_of_[id]];
+        proxy.active = active;
+        proxy.layer = layer;
+        proxy.mask = mask;
+        if (!active) {
+            // 未激活的代理排到最后，不参与扫描（保持其原有相对顺序，避免大范围移动）
+            proxy.min_x = std::numeric_limits<float>::max();
+            proxy.max_x = std::numeric_limits<float>::max();
+            return;
+        }
+        proxy.min_x = aabb.position.x;
+        proxy.max_x = aabb.position.x + aabb.size.x;
+        proxy.min_y = aabb.position.y;
+        proxy.max_y = aabb.position.y + aabb.size.y;
+    }
+
+    void SweepAndPrune::finishUpdate()
+    {
+        auto less = [](const Proxy& a, const Proxy& b) {
+            return a.min_x != b.min_x ? a.min_x < b.min_x : a.id < b.id;
+        };
+
+        if (dirty_) {
+            std::sort(proxies_.begin(), proxies_.end(), less);
+            dirty_ = false;
+        } else {
+            // 插入排序：物体每帧只移动很小距离，数组几乎有序，复杂度接近 O(n)
+            for (size_t i = 1; i < proxies_.size(); ++i) {
+                Proxy key = proxies_[i];
+                size_t j = i;
+                while (j > 0 && less(key, proxies_[j - 1])) {
+                    proxies_[j] = proxies_[j - 1];
+                    --j;
+                }
+                proxies_[j] = key;
+            }
+        }
+
+        max_width_ = 0.0f;
+        boxes_.resize(proxies_.size());
+        for (size_t i = 0; i < proxies_.size(); ++i) {
+            const auto& proxy = proxies_[i];
+            slot_of_[proxy.id] = static_cast<std::uint32_t>(i);
+            if (proxy.active) {
+                max_width_ = std::max(max_width_, proxy.max_x - proxy.min_x);
+                boxes_.set(i, {proxy.min_x, proxy.min_y}, {proxy.max_x, proxy.max_y});
+            } else {
+                // 未激活代理的 X 区间位于无穷远处，批量检测时不会命中
+                boxes_.set(i, {proxy.min_x, 0.0f}, {proxy.max_x, 0.0f});
+            }
+        }
+    }
+
+    void SweepAndPrune::computePairs(std::vector<std::uint64_t> &out_pairs) const
+    {
+        out_pairs.clear();
+        computePairsInRange(0, proxies_.size(), out_pairs);
+        // 按编号排序，使处理顺序与暴力检测一致
+        std::sort(out_pairs.begin(), out_pairs.end());
+    }
+
+    void SweepAndPrune::computePairsInRange(size_t begin, size_t end, std::vector<std::uint64_t> &out_pairs) const
+    {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& a = proxies_[i];
+            if (!a.active) break;   // 之后全部是未激活代理
+
+            // 右侧代理的 min_x 一旦不小于 a.max_x，X 区间便不再重叠，扫描结束（min_x 有序，二分查找结束位置）
+            const auto sweep_end = static_cast<size_t>(std::lower_bound(boxes_.min_x.begin() + static_cast<std::ptrdiff_t>(i) + 1,
+                                                                        boxes_.min_x.end(), a.max_x) - boxes_.min_x.begin());
+            const glm::vec2 a_min = {a.min_x, a.min_y};
+            const glm::vec2 a_max = {a.max_x, a.max_y};
+            for (size_t first = i + 1; first < sweep_end; first += 64) {
+                auto mask = collision::checkAABBOverlapBatch(a_min, a_max, boxes_, first, std::min<size_t>(64, sweep_end - first));
+                while (mask) {
+                    const auto& b = proxies_[first + static_cast<size_t>(std::countr_zero(mask))];
+                    mask &= mask - 1;
+                    if (!shouldLayersCollide(a.layer, a.mask, b.layer, b.mask)) continue;
+                    out_pairs.push_back(makePairKey(std::min(a.id, b.id), std::max(a.id, b.id)));
+                }
+            }
+        }
+    }
+
+    void SweepAndPrune::query(const engine::utils::Rect &aabb, std::vector<std::uint32_t> &out_ids) const
+    {
+        const float min_x = aabb.position.x;
+        const float max_x = aabb.position.x + aabb.size.x;
+        const float min_y = aabb.position.y;
+        const float max_y = aabb.position.y + aabb.size.y;
+
+        // 任何与查询区间重叠的代理，其 min_x 必然大于 min_x - max_width_，且小于 max_x
+        const auto begin = static_cast<size_t>(std::lower_bound(boxes_.min_x.begin(), boxes_.min_x.end(), min_x - max_width_) - boxes_.min_x.begin());
+        const auto end = static_cast<size_t>(std::lower_bound(boxes_.min_x.begin() + static_cast<std::ptrdiff_t>(begin),
+                                                              boxes_.min_x.end(), max_x) - boxes_.min_x.begin());
+        for (size_t first = begin; first < end; first += 64) {
+            auto mask = collision::checkAABBOverlapBatch({min_x, min_y}, {max_x, max_y}, boxes_, first, std::min<size_t>(64, end - first));
+            while (mask) {
+                out_ids.push_back(proxies_[first + static_cast<size_t>(std::countr_zero(mask))].id);
+                mask &= mask - 1;
+            }
+        }
+    }
+
+}   // namespace engine::physics
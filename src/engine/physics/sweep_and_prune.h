@@ -0,0 +1,86 @@
+#pragma once
+#include "../utils/math.h"
+#include "collision.h"
+#include "collision_layer.h"
+#include <vector>
+#include <cstdint>
+
+namespace engine::physics {
+
+/**
+ * @brief 排序扫描（Sweep And Prune）宽阶段，沿 X 轴
+ *
+ * 代理数组按包围盒左端点（min_x）排序并在帧间保留，每帧只更新端点后用插入排序修正，
+ * 利用帧间连贯性使排序接近 O(n)。横版关卡沿 X 轴很长，扫描时只需比较 X 区间重叠的相邻代理。
+ * 排序后的包围盒另存一份打包数组，区间内的重叠测试使用 collision::checkAABBOverlapBatch 批量完成。
+ */
+class SweepAndPrune final {
+private:
+    struct Proxy {
+        float min_x;
+        float max_x;
+        float min_y;
+        float max_y;
+        std::uint32_t id;       // 代理编号（PhysicsEngine 中为刚体下标）
+        CollisionMask layer;    // 所属碰撞层
+        CollisionMask mask;     // 检测掩码
+        bool active;            // 本帧是否参与检测
+    };
+
+    std::vector<Proxy> proxies_;            // 按 min_x 升序排列的代理（持久保存）
+    std::vector<std::uint32_t> slot_of_;    // id -> proxies_ 中的位置
+    collision::PackedAABBs boxes_;          // 与 proxies_ 顺序一致的打包包围盒（finishUpdate 时生成）
+    float max_width_ = 0.0f;                // 本帧最宽代理的宽度（用于区间查询）
+    bool dirty_ = true;                     // 代理集合发生变化，需要整体重建
+
+public:
+    SweepAndPrune() = default;
+
+    /// @brief 代理集合变化（注册/注销组件导致编号变化）后调用，下一次更新时整体重建
+    void markDirty() { dirty_ = true; }
+
+    /**
+     * @brief 开始新一帧的更新，count 为代理总数（编号 0 ~ count-1）
+     */
+    void beginUpdate(size_t count);
+
+    /**
+     * @brief 更新代理的包围盒（必须在 beginUpdate 之后、finishUpdate 之前调用）
+     *
+     * @param id 代理编号
+     * @param aabb 世界坐标下的包围盒
+     * @param active 是否参与本帧检测
+     * @param layer 所属碰撞层
+     * @param mask 检测掩码（层/掩码不匹配的对不会输出）
+     */
+    void setProxy(std::uint32_t id, const engine::utils::Rect& aabb, bool active,
+                  CollisionMask layer = CollisionLayer::ALL, CollisionMask mask = CollisionLayer::ALL);
+
+    /// @brief 插入排序修正顺序
+    void finishUpdate();
+
+    /**
+     * @brief 扫描生成候选对（包围盒严格重叠且层/掩码匹配，a < b），结果按 (a, b) 升序排列
+     *
+     * @param out_pairs 输出容器（先清空）
+     */
+    void computePairs(std::vector<std::uint64_t>& out_pairs) const;
+
+    /**
+     * @brief 只扫描排序位置在 [begin, end) 的代理生成候选对（追加写入，不清空、不排序），用于并行扫描
+     *
+     * 各区间的结果合并后排序，与 computePairs 的结果相同。
+     */
+    void computePairsInRange(size_t begin, size_t end, std::vector<std::uint64_t>& out_pairs) const;
+    size_t getProxyCount() const { return proxies_.size(); }
+
+    /**
+     * @brief 查询与包围盒重叠的代理（基于本帧 finishUpdate 时的位置）
+     *
+     * @param aabb 查询包围盒
+     * @param out_ids 输出容器（追加写入，不清空）
+     */
+    void query(const engine::utils::Rect& aabb, std::vector<std::uint32_t>& out_ids) const;
+};
+
+}   // namespace engine::physics
@@ -0,0 +1,327 @@
+#include "tile_collision_view.h"
+#include "collision.h"
+#include "../component/tilelayer_component.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <glm/glm.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+    using engine::component::TileType;
+
+    static_assert(static_cast<std::size_t>(TileType::LADDER) < TileCollisionView::MAX_TILE_TYPES,
+                  "TileCollisionView: too many tile types for the slope profile table");
+
+namespace {
+    constexpr float CONTACT_SLOP = 0.01f;   // 起点嵌入瓦片不超过该距离（像素）时仍视为接触，避免贴着瓦片移动时因浮点误差穿过
+
+    /// @brief 瓦片的碰撞形状：底边为 [left, right]，左右两侧的高度分别为 left_height、right_height（实心瓦片两者都等于瓦片高度）
+    struct TileShape {
+        float left;
+        float right;
+        float bottom;
+        float left_height;
+        float right_height;
+    };
+
+    /**
+     * @brief 包围盒沿位移扫掠瓦片形状，按分离轴（x 轴、y 轴与斜坡法线）求进入时间与碰撞法线
+     *
+     * @return bool 是否在 [0, 1] 内进入（起点已嵌入则不算，嵌入不超过 CONTACT_SLOP 时视为在 0 时刻接触）
+     */
+    bool sweepBoxTile(const glm::vec2& position, const glm::vec2& size, const glm::vec2& motion, const TileShape& shape,
+                      float& out_time, glm::vec2& out_normal)
+    {
+        const glm::vec2 vertices[4] = {{shape.left, shape.bottom},
+                                       {shape.right, shape.bottom},
+                                       {shape.right, shape.bottom - shape.right_height},
+                                       {shape.left, shape.bottom - shape.left_height}};
+        glm::vec2 axes[3] = {{1.0f, 0.0f}, {0.0f, 1.0f}, {0.0f, 0.0f}};
+        int axis_count = 2;
+        if (shape.left_height != shape.right_height) {
+            // 斜边的法线（朝上）
+            axes[axis_count++] = glm::normalize(glm::vec2(shape.left_height - shape.right_height, shape.left - shape.right));
+        }
+
+        const glm::vec2 half_size = size * 0.5f;
+        const glm::vec2 center = position + half_size;
+        float t_enter = -std::numeric_limits<float>::infinity();
+        float t_exit = std::numeric_limits<float>::infinity();
+        float enter_speed = 0.0f;
+        for (int i = 0; i < axis_count; ++i) {
+            const auto& axis = axes[i];
+            float shape_min = std::numeric_limits<float>::infinity();
+            float shape_max = -std::numeric_limits<float>::infinity();
+            for (const auto& vertex : vertices) {
+                const float projection = glm::dot(vertex, axis);
+                shape_min = std::min(shape_min, projection);
+                shape_max = std::max(shape_max, projection);
+            }
+            const float radius = half_size.x * std::abs(axis.x) + half_size.y * std::abs(axis.y);
+            const float box_min = glm::dot(center, axis) - radius;
+            const float box_max = glm::dot(center, axis) + radius;
+            const float speed = glm::dot(motion, axis);
+            if (speed == 0.0f) {
+                // 该轴上不移动：必须已重叠（贴边或嵌入极浅不算）
+                if (box_max <= shape_min + CONTACT_SLOP || box_min >= shape_max - CONTACT_SLOP) return false;
+                continue;
+            }
+            const float t0 = (speed > 0.0f ? shape_min - box_max : shape_max - box_min) / speed;
+            const float t1 = (speed > 0.0f ? shape_max - box_min : shape_min - box_max) / speed;
+            if (t0 > t_enter) {
+                t_enter = t0;
+                enter_speed = std::abs(speed);
+                out_normal = speed > 0.0f ? -axis : axis;
+            }
+            t_exit = std::min(t_exit, t1);
+        }
+        if (t_enter < 0.0f && -t_enter * enter_speed <= CONTACT_SLOP) t_enter = 0.0f;
+        if (t_enter < 0.0f || t_enter > 1.0f || t_enter >= t_exit) return false;
+        out_time = t_enter;
+        return true;
+    }
+} // namespace
+
+    void TileCollisionView::build(glm::ivec2 tile_size, glm::ivec2 map_size, const std::vector<engine::component::TileInfo>& tiles)
+    {
+        types_.clear();
+        trigger_cells_.clear();
+        trigger_row_offsets_.clear();
+        map_size_ = {0, 0};
+        tile_size_ = glm::vec2(tile_size);
+        slope_profiles_.fill(SlopeProfile{});
+
+        if (map_size.x <= 0 || map_size.y <= 0 || tiles.size() != static_cast<size_t>(map_size.x) * static_cast<size_t>(map_size.y)) {
+            spdlog::trace("TileCollisionView: empty tile layer");
+            return;
+        }
+
+        map_size_ = map_size;
+        types_.reserve(tiles.size());
+        for (const auto& tile : tiles) {
+            types_.push_back(static_cast<std::uint8_t>(tile.type));
+        }
+
+        // 触发瓦片的稀疏索引（行主序遍历，行内自然按 x 升序）
+        const auto trigger_types = getTriggerTileTypes();
+        trigger_row_offsets_.reserve(static_cast<size_t>(map_size_.y) + 1);
+        for (int y = 0; y < map_size_.y; ++y) {
+            trigger_row_offsets_.push_back(static_cast<std::uint32_t>(trigger_cells_.size()));
+            for (int x = 0; x < map_size_.x; ++x) {
+                const auto type = types_[static_cast<size_t>(y) * static_cast<size_t>(map_size_.x) + static_cast<size_t>(x)];
+                if (trigger_types & (1u << type)) trigger_cells_.push_back(TriggerCell{x, type});
+            }
+        }
+        trigger_row_offsets_.push_back(static_cast<std::uint32_t>(trigger_cells_.size()));
+
+        // 斜坡高度剖面，各项与原公式的运算顺序保持一致（乘以 0.5 不引入额外舍入）
+        const float h = tile_size_.y;
+        auto set_profile = [this](TileType type, float base, float gradient, float scale, float offset) {
+            slope_profiles_[static_cast<std::size_t>(type)] = SlopeProfile{base, gradient, scale, offset};
+        };
+        set_profile(TileType::SLOPE_0_1, 0.0f,  1.0f, h,        0.0f);      // rel_x * h
+        set_profile(TileType::SLOPE_0_2, 0.0f,  1.0f, h * 0.5f, 0.0f);      // rel_x * h / 2
+        set_profile(TileType::SLOPE_2_1, 0.0f,  1.0f, h * 0.5f, h * 0.5f);  // rel_x * h / 2 + h / 2
+        set_profile(TileType::SLOPE_1_0, 1.0f, -1.0f, h,        0.0f);      // (1 - rel_x) * h
+        set_profile(TileType::SLOPE_2_0, 1.0f, -1.0f, h * 0.5f, 0.0f);      // (1 - rel_x) * h / 2
+        set_profile(TileType::SLOPE_1_2, 1.0f, -1.0f, h * 0.5f, h * 0.5f);  // (1 - rel_x) * h / 2 + h / 2
+
+        spdlog::trace("TileCollisionView built: {}x{} tiles, {} trigger tiles", map_size_.x, map_size_.y, trigger_cells_.size());
+    }
+
+    bool TileCollisionView::sweepAABB(const glm::vec2 &position, const glm::vec2 &size, const glm::vec2 &motion, TileSweepHit &out_hit) const
+    {
+        if (types_.empty() || (motion.x == 0.0f && motion.y == 0.0f)) return false;
+
+        // 只遍历包围盒与地图重叠的时间段 [t_begin, t_end]（也避免极远处的坐标转换为 int 时溢出）
+        const glm::vec2 map_max = glm::vec2(map_size_) * tile_size_;
+        float t_begin = 0.0f;
+        float t_end = 1.0f;
+        for (int a = 0; a < 2; ++a) {
+            if (motion[a] == 0.0f) {
+                if (position[a] >= map_max[a] || position[a] + size[a] <= 0.0f) return false;
+                continue;
+            }
+            const bool forward = motion[a] > 0.0f;
+            t_begin = std::max(t_begin, ((forward ? 0.0f : map_max[a]) - (forward ? position[a] + size[a] : position[a])) / motion[a]);
+            t_end = std::min(t_end, ((forward ? map_max[a] : 0.0f) - (forward ? position[a] : position[a] + size[a])) / motion[a]);
+        }
+        if (t_begin > t_end) return false;
+
+        bool found = false;
+        const auto test_tile = [&](int x, int y) {
+            const auto type = static_cast<TileType>(types_[static_cast<size_t>(y) * static_cast<size_t>(map_size_.x) + static_cast<size_t>(x)]);
+            TileShape shape{x * tile_size_.x, (x + 1) * tile_size_.x, (y + 1) * tile_size_.y, tile_size_.y, tile_size_.y};
+            if (type != TileType::SOLID && !(type == TileType::UNISOLID && motion.y > 0.0f)) {
+                shape.left_height = slopeHeightAt(type, 0.0f);
+                shape.right_height = slopeHeightAt(type, tile_size_.x);
+                if (shape.left_height <= 0.0f && shape.right_height <= 0.0f) return;    // 不阻挡的瓦片
+            }
+            float time = 0.0f;
+            glm::vec2 normal;
+            if (!sweepBoxTile(position, size, motion, shape, time, normal)) return;
+            // 单向平台只阻挡从上方落下
+            if (type == TileType::UNISOLID && normal.y >= 0.0f) return;
+            if (found && time >= out_hit.time) return;
+
+            found = true;
+            out_hit.time = time;
+            out_hit.normal = normal;
+            out_hit.position = position + motion * time;
+            // 沿坐标轴碰撞时直接贴到瓦片边缘，避免浮点误差使包围盒嵌入瓦片
+            if (normal.y == 0.0f) out_hit.position.x = normal.x < 0.0f ? shape.left - size.x : shape.right;
+            if (normal.x == 0.0f) out_hit.position.y = normal.y < 0.0f ? shape.bottom - std::max(shape.left_height, shape.right_height) - size.y : shape.bottom;
+            out_hit.tile = {x, y};
+        };
+        // 检测 [x_begin, x_end] x [y_begin, y_end] 中位于地图内的瓦片
+        const auto test_tiles = [&](int x_begin, int x_end, int y_begin, int y_end) {
+            for (int y = std::max(y_begin, 0); y <= std::min(y_end, map_size_.y - 1); ++y) {
+                for (int x = std::max(x_begin, 0); x <= std::min(x_end, map_size_.x - 1); ++x) {
+                    test_tile(x, y);
+                }
+            }
+        };
+
+        // 包围盒在 t 时刻占据的瓦片范围（恰好落在网格线上的边不算占据另一侧的瓦片），限制在地图外一圈以内
+        const glm::vec2 cell_lower(-1.0f);
+        const glm::vec2 cell_upper = glm::vec2(map_size_);
+        const auto first_cell = [&](int a, float t) {
+            return static_cast<int>(std::clamp(std::floor((position[a] + motion[a] * t) / tile_size_[a]), cell_lower[a], cell_upper[a]));
+        };
+        const auto last_cell = [&](int a, float t) {
+            return static_cast<int>(std::clamp(std::ceil((position[a] + size[a] + motion[a] * t) / tile_size_[a]) - 1.0f, cell_lower[a], cell_upper[a]));
+        };
+        glm::ivec2 first = {first_cell(0, t_begin), first_cell(1, t_begin)};
+        glm::ivec2 last = {last_cell(0, t_begin), last_cell(1, t_begin)};
+        test_tiles(first.x, last.x, first.y, last.y);
+
+        // 按时间顺序处理前缘越过网格线的事件：每次前缘进入新的一列（行），只检测该列（行）中当前占据的瓦片
+        while (true) {
+            glm::vec2 t_next = {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
+            for (int a = 0; a < 2; ++a) {
+                if (motion[a] > 0.0f && last[a] < map_size_[a] - 1) {
+                    t_next[a] = ((last[a] + 1) * tile_size_[a] - (position[a] + size[a])) / motion[a];
+                } else if (motion[a] < 0.0f && first[a] > 0) {
+                    t_next[a] = (first[a] * tile_size_[a] - position[a]) / motion[a];
+                }
+            }
+            const int axis = t_next.x <= t_next.y ? 0 : 1;
+            const float t = t_next[axis];
+            // 之后进入的瓦片不可能更早碰到
+            if (t > t_end || (found && t > out_hit.time)) break;
+
+            int entered = 0;
+            if (motion[axis] > 0.0f) {
+                entered = ++last[axis];
+                first[axis] = std::max(first[axis], first_cell(axis, t));   // 后缘已离开的列（行）不再需要
+            } else {
+                entered = --first[axis];
+                last[axis] = std::min(last[axis], last_cell(axis, t));
+            }
+            if (axis == 0) {
+                test_tiles(entered, entered, first.y, last.y);
+            } else {
+                test_tiles(first.x, last.x, entered, entered);
+            }
+        }
+        return found;
+    }
+
+    TileTypeMask TileCollisionView::queryTriggers(int x_begin, int y_begin, int x_end, int y_end) const
+    {
+        if (trigger_cells_.empty()) return 0;
+        x_begin = std::max(x_begin, 0);
+        y_begin = std::max(y_begin, 0);
+        x_end = std::min(x_end, map_size_.x);
+        y_end = std::min(y_end, map_size_.y);
+
+        TileTypeMask mask = 0;
+        for (int y = y_begin; y < y_end; ++y) {
+            const auto first = trigger_cells_.begin() + trigger_row_offsets_[static_cast<size_t>(y)];
+            const auto last = trigger_cells_.begin() + trigger_row_offsets_[static_cast<size_t>(y) + 1];
+            if (first == last) continue;
+            auto it = std::lower_bound(first, last, x_begin, [](const TriggerCell& cell, int x) { return cell.x < x; });
+            for (; it != last && it->x < x_end; ++it) {
+                mask = static_cast<TileTypeMask>(mask | (1u << it->type));
+            }
+        }
+        return mask;
+    }
+
+    bool TileCollisionView::raycast(const glm::vec2 &origin, const glm::vec2 &direction, float max_distance, TileTypeMask tile_types, RaycastHit &out_hit) const
+    {
+        if (types_.empty() || tile_types == 0) return false;
+
+        // 把射线裁剪到地图范围内，地图外的部分不需要遍历
+        const engine::utils::Rect map_rect{{0.0f, 0.0f}, glm::vec2(map_size_) * tile_size_};
+        float t = 0.0f;
+        glm::vec2 normal;
+        if (!collision::intersectRayAABB(origin, direction, max_distance, map_rect, t, normal)) return false;
+
+        const glm::vec2 start = origin + direction * t;
+        glm::ivec2 cell = glm::clamp(glm::ivec2(glm::floor(start / tile_size_)), glm::ivec2(0), map_size_ - 1);
+
+        constexpr float infinity = std::numeric_limits<float>::infinity();
+        const glm::ivec2 step = {direction.x > 0.0f ? 1 : (direction.x < 0.0f ? -1 : 0),
+                                 direction.y > 0.0f ? 1 : (direction.y < 0.0f ? -1 : 0)};
+        glm::vec2 t_max;        // 射线穿过下一条竖直/水平网格线时的距离
+        glm::vec2 t_delta;      // 穿过一整格所需的距离
+        for (int axis = 0; axis < 2; ++axis) {
+            if (step[axis] == 0) {
+                t_max[axis] = infinity;
+                t_delta[axis] = infinity;
+                continue;
+            }
+            const float boundary = static_cast<float>(cell[axis] + (step[axis] > 0 ? 1 : 0)) * tile_size_[axis];
+            t_max[axis] = (boundary - origin[axis]) / direction[axis];
+            t_delta[axis] = tile_size_[axis] / std::abs(direction[axis]);
+        }
+
+        while (static_cast<unsigned>(cell.x) < static_cast<unsigned>(map_size_.x) &&
+               static_cast<unsigned>(cell.y) < static_cast<unsigned>(map_size_.y)) {
+            const auto type = types_[static_cast<size_t>(cell.y) * static_cast<size_t>(map_size_.x) + static_cast<size_t>(cell.x)];
+            if (tile_types & (1u << type)) {
+                out_hit.object = nullptr;
+                out_hit.tile_type = static_cast<TileType>(type);
+                out_hit.tile = cell;
+                out_hit.point = origin + direction * t;
+                out_hit.normal = normal;
+                out_hit.distance = t;
+                return true;
+            }
+            // 进入 t_max 较小的一侧的相邻瓦片
+            const int axis = t_max.x < t_max.y ? 0 : 1;
+            t = t_max[axis];
+            if (t > max_distance) return false;
+            cell[axis] += step[axis];
+            t_max[axis] += t_delta[axis];
+            normal = {0.0f, 0.0f};
+            normal[axis] = static_cast<float>(-step[axis]);
+        }
+        return false;
+    }
+
+    TileTypeMask TileCollisionView::getTriggerTileTypes()
+    {
+        // TODO: 添加更多触发器类型
+        return static_cast<TileTypeMask>(tileTypeBit(TileType::HAZARD) | tileTypeBit(TileType::LADDER));
+    }
+
+    TileTypeMask TileCollisionView::getSolidTileTypes()
+    {
+        return tileTypeBit(TileType::SOLID);
+    }
+
+    TileTypeMask TileCollisionView::getGroundTileTypes()
+    {
+        TileTypeMask mask = 0;
+        for (auto type : {TileType::SOLID, TileType::UNISOLID, TileType::SLOPE_0_1, TileType::SLOPE_1_0, TileType::SLOPE_0_2,
+                          TileType::SLOPE_2_0, TileType::SLOPE_1_2, TileType::SLOPE_2_1}) {
+            mask = static_cast<TileTypeMask>(mask | tileTypeBit(type));
+        }
+        return mask;
+    }
+
+}   // namespace engine::physics
@@ -0,0 +1,138 @@
+#pragma once
+#include "tile_trigger.h"
+#include "scene_query.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <glm/vec2.hpp>
+
+namespace engine::component {
+    enum class TileType;
+    struct TileInfo;
+}
+
+namespace engine::physics {
+
+/// @brief 包围盒扫掠检测的结果
+struct TileSweepHit {
+    float time = 0.0f;                  // 碰到瓦片时已完成的位移比例 [0, 1]
+    glm::vec2 normal = {0.0f, 0.0f};    // 碰撞面的单位法线（指向包围盒一侧）
+    glm::vec2 position = {0.0f, 0.0f};  // 接触时包围盒左上角的坐标（沿坐标轴碰撞时恰好贴住瓦片边缘）
+    glm::ivec2 tile = {0, 0};           // 碰到的瓦片坐标
+};
+
+/**
+ * @brief 瓦片层的紧凑碰撞视图
+ *
+ * 在瓦片层加载时生成，每个瓦片只保存 1 字节的类型（行主序），不再访问携带 Sprite 的 TileInfo，
+ * 斜坡高度由按类型预先计算的线性高度剖面查表得到（取代逐次 switch）。
+ * 越界查询静默返回 EMPTY，不输出日志，供物理引擎热路径使用。
+ * 触发瓦片（HAZARD、LADDER 等）另外按行建立稀疏索引，区域查询只访问实际存在的触发瓦片。
+ */
+class TileCollisionView final {
+public:
+    static constexpr std::size_t MAX_TILE_TYPES = 16;   // 高度剖面表容量（TileType 的取值需小于该值）
+
+private:
+    /// @brief 斜坡高度剖面：height = (base + gradient * rel_x) * scale + offset，rel_x 为瓦片内归一化横坐标
+    struct SlopeProfile {
+        float base = 0.0f;
+        float gradient = 0.0f;
+        float scale = 0.0f;
+        float offset = 0.0f;
+    };
+
+    /// @brief 触发瓦片（按行分组，行内按 x 升序）
+    struct TriggerCell {
+        std::int32_t x;
+        std::uint8_t type;
+    };
+
+    glm::ivec2 map_size_ = {0, 0};          // 地图尺寸（瓦片数）
+    glm::vec2 tile_size_ = {0.0f, 0.0f};    // 单个瓦片尺寸（像素）
+    std::vector<std::uint8_t> types_;       // 瓦片类型（行主序，index = y * map_width + x）
+    std::array<SlopeProfile, MAX_TILE_TYPES> slope_profiles_{};    // 按瓦片类型索引的高度剖面（非斜坡全为 0）
+    std::vector<TriggerCell> trigger_cells_;            // 所有触发瓦片
+    std::vector<std::uint32_t> trigger_row_offsets_;    // 第 y 行的触发瓦片位于 [offsets[y], offsets[y + 1])
+
+public:
+    TileCollisionView() = default;
+
+    /**
+     * @brief 根据瓦片信息重新生成视图
+     *
+     * @param tile_size 单个瓦片尺寸（像素）
+     * @param map_size 地图尺寸（瓦片数），需与 tiles 数量一致，否则生成空视图
+     * @param tiles 行主序的瓦片信息
+     */
+    void build(glm::ivec2 tile_size, glm::ivec2 map_size, const std::vector<engine::component::TileInfo>& tiles);
+
+    /// @brief 获取瓦片类型，越界时返回 EMPTY（不输出日志）
+    engine::component::TileType typeAt(int x, int y) const {
+        // 负数转为无符号后必然大于地图尺寸，一次比较即可完成上下界检查
+        const bool inside = static_cast<unsigned>(x) < static_cast<unsigned>(map_size_.x) &&
+                            static_cast<unsigned>(y) < static_cast<unsigned>(map_size_.y);
+        return static_cast<engine::component::TileType>(
+            inside ? types_[static_cast<std::size_t>(y) * static_cast<std::size_t>(map_size_.x) + static_cast<std::size_t>(x)] : 0);
+    }
+
+    /**
+     * @brief 获取斜坡瓦片在指定宽度处的高度（非斜坡返回 0）
+     *
+     * @param type 瓦片类型
+     * @param width 从瓦片左侧起算的宽度（像素），会被限制在瓦片内
+     */
+    float slopeHeightAt(engine::component::TileType type, float width) const {
+        const auto& profile = slope_profiles_[static_cast<std::size_t>(type) & (MAX_TILE_TYPES - 1)];
+        float rel_x = width / tile_size_.x;
+        rel_x = rel_x < 0.0f ? 0.0f : (rel_x > 1.0f ? 1.0f : rel_x);
+        return (profile.base + profile.gradient * rel_x) * profile.scale + profile.offset;
+    }
+
+    /**
+     * @brief 包围盒沿位移扫掠，求最早碰到的瓦片（SOLID、斜坡，向下移动时也包括从上方落到的 UNISOLID）
+     *
+     * 按网格 DDA 只访问包围盒前缘扫过的瓦片，碰撞时间晚于已找到的命中即停止；斜坡按高度剖面构成的多边形求碰撞时间。
+     * 起点已嵌入的瓦片忽略（嵌入极浅时视为接触）。
+     * @param position 包围盒左上角（像素坐标）
+     * @param size 包围盒尺寸
+     * @param motion 本步位移
+     * @param out_hit 输出：碰撞信息
+     * @return bool 是否在位移范围内碰到
+     */
+    bool sweepAABB(const glm::vec2& position, const glm::vec2& size, const glm::vec2& motion, TileSweepHit& out_hit) const;
+
+    /**
+     * @brief 查询瓦片区域 [x_begin, x_end) x [y_begin, y_end) 内的触发瓦片类型（越界部分忽略）
+     *
+     * @return TileTypeMask 出现过的触发瓦片类型位掩码
+     */
+    TileTypeMask queryTriggers(int x_begin, int y_begin, int x_end, int y_end) const;
+    bool hasTriggers() const { return !trigger_cells_.empty(); }
+
+    /**
+     * @brief 射线与瓦片求交（网格 DDA，只访问射线经过的瓦片）
+     *
+     * 斜坡按整格处理；射线先被裁剪到地图范围内，起点所在瓦片即阻挡时距离为 0。
+     * @param origin 射线起点（像素坐标）
+     * @param direction 单位方向向量
+     * @param max_distance 最大检测距离
+     * @param tile_types 阻挡射线的瓦片类型
+     * @param out_hit 输出：命中信息（object 为空）
+     * @return bool 是否命中
+     */
+    bool raycast(const glm::vec2& origin, const glm::vec2& direction, float max_distance, TileTypeMask tile_types, RaycastHit& out_hit) const;
+
+    /// @brief 会被记录为触发瓦片的类型
+    static TileTypeMask getTriggerTileTypes();
+    /// @brief 实心瓦片（SOLID），射线检测的默认阻挡类型，适用于视线检测
+    static TileTypeMask getSolidTileTypes();
+    /// @brief 可站立的瓦片（SOLID、UNISOLID 与所有斜坡），适用于地面/悬崖检测
+    static TileTypeMask getGroundTileTypes();
+
+    const glm::ivec2& getMapSize() const { return map_size_; }
+    const glm::vec2& getTileSize() const { return tile_size_; }
+    bool empty() const { return types_.empty(); }
+};
+
+}   // namespace engine::physics
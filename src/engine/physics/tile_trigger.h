@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::component {
+    enum class TileType;
+}
+
+namespace engine::physics {
+
+/// @brief 瓦片类型位掩码（第 n 位对应取值为 n 的 TileType），用于累积刚体接触到的触发瓦片，或指定射线检测中阻挡射线的瓦片
+using TileTypeMask = std::uint16_t;
+
+/// @brief 瓦片类型对应的位
+inline TileTypeMask tileTypeBit(engine::component::TileType type) {
+    return static_cast<TileTypeMask>(1u << static_cast<unsigned>(type));
+}
+
+/// @brief 瓦片触发事件的阶段
+enum class TileTriggerPhase : std::uint8_t {
+    ENTER,      // 本步开始接触
+    STAY,       // 上一步与本步都在接触
+    EXIT,       // 本步不再接触
+};
+
+/// @brief 瓦片触发事件：同一刚体与同一类型的触发瓦片，每步最多产生一个事件
+struct TileTriggerEvent {
+    engine::object::GameObject* object;
+    engine::component::TileType type;
+    TileTriggerPhase phase;
+};
+
+}   // namespace engine::physics
@@ -0,0 +1,196 @@
+#include "uniform_grid.h"
+#include "broadphase.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+    UniformGrid::UniformGrid(float cell_size)
+    {
+        setCellSize(cell_size);
+    }
+
+    void UniformGrid::setCellSize(float cell_size)
+    {
+        if (cell_size <= 0.0f) {
+            spdlog::warn("UniformGrid::setCellSize() - invalid cell size {}, keep {}", cell_size, cell_size_);
+            return;
+        }
+        cell_size_ = cell_size;
+        inv_cell_size_ = 1.0f / cell_size;
+    }
+
+    void UniformGrid::clear()
+    {
+        entries_.clear();
+        for (auto slot : oversized_) {
+            proxy_oversized_[slot] = false;
+        }
+        oversized_.clear();
+        proxies_.clear();
+        bounds_min_ = glm::vec2(std::numeric_limits<float>::infinity());
+        bounds_max_ = glm::vec2(-std::numeric_limits<float>::infinity());
+    }
+
+    void UniformGrid::insert(std::uint32_t proxy, const engine::utils::Rect &aabb, CollisionMask layer, CollisionMask mask)
+    {
+        const auto slot = static_cast<std::uint32_t>(proxies_.size());
+        if (slot >= proxy_boxes_.size()) {
+            proxy_boxes_.resize(slot + 1);
+            proxy_layers_.resize(slot + 1);
+            proxy_masks_.resize(slot + 1);
+            proxy_oversized_.resize(slot + 1, false);
+        }
+        proxy_boxes_.set(slot, aabb.position, aabb.position + aabb.size);
+        proxy_layers_[slot] = layer;
+        proxy_masks_[slot] = mask;
+        proxies_.push_back(proxy);
+        bounds_min_ = glm::min(bounds_min_, aabb.position);
+        bounds_max_ = glm::max(bounds_max_, aabb.position + aabb.size);
+
+        // 右/下边缘直接取 floor，恰好落在网格线上的物体会多占一格，但不会漏检
+        const auto min_cell = toCell(aabb.position);
+        const auto max_cell = toCell(aabb.position + aabb.size);
+        const auto cell_count = (static_cast<std::int64_t>(max_cell.x) - min_cell.x + 1) * (static_cast<std::int64_t>(max_cell.y) - min_cell.y + 1);
+        if (cell_count > MAX_PROXY_CELLS) {
+            proxy_oversized_[slot] = true;
+            oversized_.push_back(slot);
+            return;
+        }
+
+        for (int y = min_cell.y; y <= max_cell.y; ++y) {
+            for (int x = min_cell.x; x <= max_cell.x; ++x) {
+                entries_.push_back({makeCellKey(x, y), slot});
+            }
+        }
+    }
+
+    void UniformGrid::computePairs(std::vector<std::uint64_t> &out_pairs)
+    {
+        out_pairs.clear();
+
+        // 按 (网格, 槽位) 排序，同一网格的代理相邻且按插入顺序排列
+        prepareRuns();
+        computeRunPairs(0, runs_.size(), out_pairs, run_boxes_);
+        computeOversizedPairs(out_pairs);
+
+        // 跨越多个网格的物体对会重复出现，排序去重后顺序与暴力双重循环一致
+        std::sort(out_pairs.begin(), out_pairs.end());
+        out_pairs.erase(std::unique(out_pairs.begin(), out_pairs.end()), out_pairs.end());
+    }
+
+    void UniformGrid::build()
+    {
+        std::sort(entries_.begin(), entries_.end(), [](const CellEntry& a, const CellEntry& b) {
+            return a.cell_key != b.cell_key ? a.cell_key < b.cell_key : a.slot < b.slot;
+        });
+    }
+
+    size_t UniformGrid::prepareRuns()
+    {
+        build();
+        runs_.clear();
+        size_t run_begin = 0;
+        while (run_begin < entries_.size()) {
+            size_t run_end = run_begin + 1;
+            while (run_end < entries_.size() && entries_[run_end].cell_key == entries_[run_begin].cell_key) {
+                ++run_end;
+            }
+            if (run_end - run_begin > 1) {
+                runs_.push_back({static_cast<std::uint32_t>(run_begin), static_cast<std::uint32_t>(run_end)});
+            }
+            run_begin = run_end;
+        }
+        return runs_.size();
+    }
+
+    void UniformGrid::computeRunPairs(size_t first_run, size_t last_run, std::vector<std::uint64_t> &out_pairs,
+                                      collision::PackedAABBs &scratch) const
+    {
+        for (size_t r = first_run; r < last_run; ++r) {
+            const size_t run_begin = runs_[r].begin;
+            const size_t run_size = runs_[r].end - run_begin;
+
+            // 收集本网格内代理的包围盒，逐个与其后的代理批量检测
+            scratch.clear();
+            for (size_t i = 0; i < run_size; ++i) {
+                const auto slot = entries_[run_begin + i].slot;
+                scratch.push_back({proxy_boxes_.min_x[slot], proxy_boxes_.min_y[slot]},
+                                  {proxy_boxes_.max_x[slot], proxy_boxes_.max_y[slot]});
+            }
+            for (size_t i = 0; i + 1 < run_size; ++i) {
+                const auto slot_a = entries_[run_begin + i].slot;
+                const glm::vec2 box_min = {scratch.min_x[i], scratch.min_y[i]};
+                const glm::vec2 box_max = {scratch.max_x[i], scratch.max_y[i]};
+                for (size_t first = i + 1; first < run_size; first += 64) {
+                    auto mask = collision::checkAABBOverlapBatch(box_min, box_max, scratch, first, std::min<size_t>(64, run_size - first));
+                    while (mask) {
+                        const auto j = first + static_cast<size_t>(std::countr_zero(mask));
+                        mask &= mask - 1;
+                        const auto slot_b = entries_[run_begin + j].slot;
+                        if (!shouldLayersCollide(proxy_layers_[slot_a], proxy_masks_[slot_a], proxy_layers_[slot_b], proxy_masks_[slot_b])) continue;
+                        pushPair(slot_a, slot_b, out_pairs);
+                    }
+                }
+            }
+        }
+    }
+
+    void UniformGrid::computeOversizedPairs(std::vector<std::uint64_t> &out_pairs) const
+    {
+        const auto slot_count = static_cast<std::uint32_t>(proxies_.size());
+        for (auto slot_a : oversized_) {
+            const glm::vec2 box_min = {proxy_boxes_.min_x[slot_a], proxy_boxes_.min_y[slot_a]};
+            const glm::vec2 box_size = glm::vec2(proxy_boxes_.max_x[slot_a], proxy_boxes_.max_y[slot_a]) - box_min;
+            for (std::uint32_t slot_b = 0; slot_b < slot_count; ++slot_b) {
+                // 两个超大代理之间的对只由槽位较小的一方生成
+                if (slot_b == slot_a || (proxy_oversized_[slot_b] && slot_b < slot_a)) continue;
+                const glm::vec2 other_min = {proxy_boxes_.min_x[slot_b], proxy_boxes_.min_y[slot_b]};
+                const glm::vec2 other_size = glm::vec2(proxy_boxes_.max_x[slot_b], proxy_boxes_.max_y[slot_b]) - other_min;
+                if (!collision::checkAABBOverlap(box_min, box_size, other_min, other_size)) continue;
+                if (!shouldLayersCollide(proxy_layers_[slot_a], proxy_masks_[slot_a], proxy_layers_[slot_b], proxy_masks_[slot_b])) continue;
+                pushPair(slot_a, slot_b, out_pairs);
+            }
+        }
+    }
+
+    void UniformGrid::query(const engine::utils::Rect &aabb, std::vector<std::uint32_t> &out_proxies) const
+    {
+        const auto min_cell = toCell(aabb.position);
+        const auto max_cell = toCell(aabb.position + aabb.size);
+
+        for (int y = min_cell.y; y <= max_cell.y; ++y) {
+            for (int x = min_cell.x; x <= max_cell.x; ++x) {
+                const auto key = makeCellKey(x, y);
+                // entries_ 已按网格键排序，二分查找该网格的记录区间
+                auto it = std::lower_bound(entries_.begin(), entries_.end(), key, [](const CellEntry& entry, std::uint64_t k) {
+                    return entry.cell_key < k;
+                });
+                for (; it != entries_.end() && it->cell_key == key; ++it) {
+                    out_proxies.push_back(proxies_[it->slot]);
+                }
+            }
+        }
+        // 超大代理不在网格中，总是作为候选返回
+        for (auto slot : oversized_) {
+            out_proxies.push_back(proxies_[slot]);
+        }
+    }
+
+    void UniformGrid::pushPair(std::uint32_t slot_a, std::uint32_t slot_b, std::vector<std::uint64_t> &out_pairs) const
+    {
+        const auto proxy_a = proxies_[slot_a];
+        const auto proxy_b = proxies_[slot_b];
+        out_pairs.push_back(makePairKey(std::min(proxy_a, proxy_b), std::max(proxy_a, proxy_b)));
+    }
+
+    glm::ivec2 UniformGrid::toCell(const glm::vec2 &pos) const
+    {
+        // 先限制范围再转换，极远处（如一直下落的物体）的坐标落在边缘的网格中
+        const auto cell = glm::clamp(glm::floor(pos * inv_cell_size_), glm::vec2(-MAX_CELL_COORD), glm::vec2(MAX_CELL_COORD));
+        return {static_cast<int>(cell.x), static_cast<int>(cell.y)};
+    }
+
+}   // namespace engine::physics
@@ -0,0 +1,113 @@
+#pragma once
+#include "../utils/math.h"
+#include "collision.h"
+#include "collision_layer.h"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+namespace engine::physics {
+
+/**
+ * @brief 均匀网格（空间哈希）宽阶段
+ *
+ * 每帧清空后重新插入所有碰撞盒，按“网格键”排序后，同一网格内的代理两两组成候选对，
+ * 并用 collision::checkAABBOverlapBatch 批量剔除包围盒不重叠的对。
+ * 覆盖网格过多的代理（超大或跑到极远处的物体）不写入网格，单独记录并与所有代理逐一检测，避免记录数失控。
+ * 内部按插入顺序（槽位）存放代理数据，代理编号可以是任意 32 位值（如带代数的刚体句柄），只在输出时换算回去。
+ * 所有容器在帧间复用，稳定状态下不产生堆分配。
+ */
+class UniformGrid final {
+private:
+    struct CellEntry {
+        std::uint64_t cell_key;     // 网格坐标打包后的键（高32位 x，低32位 y）
+        std::uint32_t slot;         // 代理的槽位（本帧插入的顺序，proxies_ 的下标）
+    };
+    struct CellRun {
+        std::uint32_t begin;        // 同一网格记录在 entries_ 中的区间
+        std::uint32_t end;
+    };
+
+    static constexpr int MAX_PROXY_CELLS = 256;         // 单个代理最多写入的网格数，超过时作为超大代理单独处理
+    static constexpr float MAX_CELL_COORD = 1 << 24;    // 网格坐标的范围（防止极远处的坐标转换为 int 时溢出）
+
+    float cell_size_ = 64.0f;       // 网格边长（像素）
+    float inv_cell_size_ = 1.0f / 64.0f;
+    std::vector<CellEntry> entries_;    // 本帧所有 (网格, 代理) 记录
+    collision::PackedAABBs proxy_boxes_;    // 按槽位存放的包围盒
+    std::vector<CollisionMask> proxy_layers_;   // 按槽位存放的碰撞层
+    std::vector<CollisionMask> proxy_masks_;    // 按槽位存放的检测掩码
+    collision::PackedAABBs run_boxes_;      // 生成候选对时，当前网格内代理的包围盒（临时缓冲）
+    std::vector<CellRun> runs_;             // 含有两个以上代理的网格（prepareRuns 时生成）
+    std::vector<std::uint32_t> proxies_;    // 本帧插入的所有代理编号（槽位 -> 代理编号）
+    std::vector<std::uint32_t> oversized_;  // 本帧超大代理的槽位（不在 entries_ 中）
+    std::vector<bool> proxy_oversized_;     // 按槽位标记是否为超大代理
+    glm::vec2 bounds_min_ = glm::vec2(std::numeric_limits<float>::infinity());     // 本帧所有代理包围盒的并集
+    glm::vec2 bounds_max_ = glm::vec2(-std::numeric_limits<float>::infinity());
+
+public:
+    explicit UniformGrid(float cell_size = 64.0f);
+
+    void setCellSize(float cell_size);
+    float getCellSize() const { return cell_size_; }
+
+    void clear();
+    bool empty() const { return proxies_.empty(); }
+    /// @brief 本帧所有代理包围盒的并集（empty() 时无意义）
+    const glm::vec2& getBoundsMin() const { return bounds_min_; }
+    const glm::vec2& getBoundsMax() const { return bounds_max_; }
+
+    /**
+     * @brief 将代理按照其包围盒插入所有覆盖到的网格
+     *
+     * @param proxy 代理编号（由调用者决定，PhysicsEngine 中为组件下标或刚体句柄）
+     * @param aabb 世界坐标下的包围盒
+     * @param layer 所属碰撞层
+     * @param mask 检测掩码（层/掩码不匹配的对不会输出）
+     */
+    void insert(std::uint32_t proxy, const engine::utils::Rect& aabb,
+                CollisionMask layer = CollisionLayer::ALL, CollisionMask mask = CollisionLayer::ALL);
+
+    /**
+     * @brief 生成包围盒重叠且层/掩码匹配的候选碰撞对（proxy_a < proxy_b），结果按 (a, b) 升序排列并去重
+     *
+     * @param out_pairs 输出容器（先清空），每个元素为 makePairKey(a, b)（见 broadphase.h）
+     */
+    void computePairs(std::vector<std::uint64_t>& out_pairs);
+
+    /// @brief 只整理记录以供 query 使用，不生成候选对（用于只查询、不自检的代理集合）
+    void build();
+
+    /// @brief 整理记录并收集含有两个以上代理的网格，返回网格数（并行生成候选对的第一步）
+    size_t prepareRuns();
+
+    /**
+     * @brief 为第 [first_run, last_run) 个网格生成候选对（追加写入，可能重复，不排序），可在多个线程中对不相交的区间同时调用
+     *
+     * @param out_pairs 输出容器
+     * @param scratch 临时缓冲（每个线程各自一份）
+     */
+    void computeRunPairs(size_t first_run, size_t last_run, std::vector<std::uint64_t>& out_pairs,
+                         collision::PackedAABBs& scratch) const;
+
+    /// @brief 为超大代理与其他所有代理生成候选对（追加写入，不排序），并行生成时需在各网格的结果之外另行调用
+    void computeOversizedPairs(std::vector<std::uint64_t>& out_pairs) const;
+
+    /**
+     * @brief 查询与指定包围盒所在网格相同的代理以及所有超大代理（需在 computePairs 或 build 之后调用，结果可能重复）
+     *
+     * @param aabb 查询包围盒
+     * @param out_proxies 输出容器（追加写入，不清空）
+     */
+    void query(const engine::utils::Rect& aabb, std::vector<std::uint32_t>& out_proxies) const;
+
+private:
+    static std::uint64_t makeCellKey(int x, int y) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+    }
+    glm::ivec2 toCell(const glm::vec2& pos) const;
+    /// @brief 输出两个槽位对应代理编号组成的候选对（编号小的在前）
+    void pushPair(std::uint32_t slot_a, std::uint32_t slot_b, std::vector<std::uint64_t>& out_pairs) const;
+};
+
+}   // namespace engine::physics
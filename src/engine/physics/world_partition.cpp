@@ -0,0 +1,56 @@
+#include "world_partition.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/common.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics {
+
+    void WorldPartition::configure(const engine::utils::Rect &world_rect, const glm::vec2 &chunk_size)
+    {
+        world_rect_ = world_rect;
+        if (chunk_size.x > 0.0f && chunk_size.y > 0.0f) chunk_size_ = chunk_size;
+        spdlog::trace("WorldPartition::configure() - world ({}, {}) {}x{}, chunk {}x{}", world_rect_.position.x, world_rect_.position.y,
+                      world_rect_.size.x, world_rect_.size.y, chunk_size_.x, chunk_size_.y);
+    }
+
+    void WorldPartition::setFocus(const engine::utils::Rect &focus_rect)
+    {
+        focus_min_ = chunkOf(focus_rect.position);
+        focus_max_ = chunkOf(focus_rect.position + focus_rect.size);
+        has_focus_ = true;
+    }
+
+    void WorldPartition::setRadii(int active_radius, int reduced_radius)
+    {
+        active_radius_ = std::max(active_radius, 0);
+        reduced_radius_ = reduced_radius;
+    }
+
+    glm::ivec2 WorldPartition::chunkOf(const glm::vec2 &position) const
+    {
+        return glm::ivec2(glm::floor((position - world_rect_.position) / chunk_size_));
+    }
+
+    RegionLevel WorldPartition::levelOf(const engine::utils::Rect &aabb) const
+    {
+        if (!has_focus_) return RegionLevel::ACTIVE;
+        const auto chunk = chunkOf(aabb.position + aabb.size * 0.5f);
+        // 到关注区块范围的切比雪夫距离（范围内为 0）
+        const int dx = std::max({focus_min_.x - chunk.x, chunk.x - focus_max_.x, 0});
+        const int dy = std::max({focus_min_.y - chunk.y, chunk.y - focus_max_.y, 0});
+        const int distance = std::max(dx, dy);
+        if (distance <= active_radius_) return RegionLevel::ACTIVE;
+        if (distance <= reduced_radius_) return RegionLevel::REDUCED;
+        return RegionLevel::DORMANT;
+    }
+
+    bool WorldPartition::isOutOfWorld(const engine::utils::Rect &aabb, float margin) const
+    {
+        const auto world_min = world_rect_.position - margin;
+        const auto world_max = world_rect_.position + world_rect_.size + margin;
+        return aabb.position.x > world_max.x || aabb.position.y > world_max.y ||
+               aabb.position.x + aabb.size.x < world_min.x || aabb.position.y + aabb.size.y < world_min.y;
+    }
+
+}   // namespace engine::physics
@@ -0,0 +1,103 @@
+#pragma once
+#include "../utils/math.h"
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::physics {
+
+/// @brief 刚体所在区块相对于关注区域（相机视野）的模拟级别
+enum class RegionLevel : std::uint8_t {
+    ACTIVE,         // 视野内或附近：每步模拟
+    REDUCED,        // 较远：降频模拟，每隔若干步模拟一次（按累计时间推进）
+    DORMANT,        // 很远：冻结，保留状态，回到较近区块时继续模拟
+};
+
+/// @brief 刚体离开世界范围后的处理策略
+enum class OutOfWorldPolicy : std::uint8_t {
+    KEEP,           // 不处理（继续模拟）
+    DEACTIVATE,     // 停用刚体（清除 ENABLED，不再模拟）
+    REMOVE,         // 停用刚体并标记所属游戏对象待删除
+};
+
+/// @brief 实体在某一步的调度结果
+struct LodTick {
+    bool run = true;            // 本步是否更新
+    float time_scale = 1.0f;    // 更新时的时间倍率（降频更新时为间隔步数）
+};
+
+/**
+ * @brief 世界区块划分：将世界范围按瓦片尺寸的整数倍切分为区块，用于按距离相机的远近决定刚体的模拟级别
+ *
+ * 区块由坐标直接计算，不保存逐区块数据；世界之外的坐标同样属于某个（虚拟）区块。
+ * 物理引擎与场景共用同一套调度（schedule()），刚体与其所属对象的逻辑总是在同一步被更新。
+ */
+class WorldPartition final {
+private:
+    engine::utils::Rect world_rect_{};      // 世界范围
+    glm::vec2 chunk_size_ = {256.0f, 256.0f};   // 区块尺寸（像素）
+    bool has_focus_ = false;                // 是否设置了关注区域，未设置时所有区块都是 ACTIVE
+    glm::ivec2 focus_min_ = {0, 0};         // 关注区域覆盖的区块范围（闭区间）
+    glm::ivec2 focus_max_ = {0, 0};
+    int active_radius_ = 1;                 // 与关注区块的距离（区块数）不超过该值时为 ACTIVE
+    int reduced_radius_ = 3;                // 不超过该值时为 REDUCED，更远为 DORMANT
+    std::uint32_t reduced_interval_ = 4;    // REDUCED 级别每隔多少步更新一次
+
+public:
+    WorldPartition() = default;
+
+    /**
+     * @brief 设置世界范围与区块尺寸
+     *
+     * @param world_rect 世界范围（通常为瓦片地图的范围）
+     * @param chunk_size 区块尺寸（通常为瓦片尺寸的整数倍），分量不大于 0 时保持原值
+     */
+    void configure(const engine::utils::Rect& world_rect, const glm::vec2& chunk_size);
+
+    void setFocus(const engine::utils::Rect& focus_rect);  // 设置关注区域（世界坐标，通常为相机视野）
+    void clearFocus() { has_focus_ = false; }
+    bool hasFocus() const { return has_focus_; }
+
+    /**
+     * @brief 设置各模拟级别的范围（以区块为单位的切比雪夫距离）
+     *
+     * @param active_radius ACTIVE 的最大距离
+     * @param reduced_radius REDUCED 的最大距离（小于 active_radius 时没有 REDUCED 区块）
+     */
+    void setRadii(int active_radius, int reduced_radius);
+    int getActiveRadius() const { return active_radius_; }
+    int getReducedRadius() const { return reduced_radius_; }
+    void setReducedInterval(int interval) { reduced_interval_ = static_cast<std::uint32_t>(interval > 1 ? interval : 1); }
+    int getReducedInterval() const { return static_cast<int>(reduced_interval_); }
+
+    /// @brief 坐标所在的区块（以世界范围的左上角为原点）
+    glm::ivec2 chunkOf(const glm::vec2& position) const;
+    /// @brief 包围盒（按中心点所在区块）的模拟级别
+    RegionLevel levelOf(const engine::utils::Rect& aabb) const;
+    /**
+     * @brief 按模拟级别决定实体在本步是否更新：ACTIVE 每步更新；REDUCED 每 reduced_interval 步更新一次，
+     * 时间倍率为间隔步数（按 key 错开，避免同一步集中更新）；DORMANT 不更新
+     *
+     * @param level 模拟级别
+     * @param step 当前步编号
+     * @param key 实体的稳定编号（如刚体句柄）
+     */
+    LodTick schedule(RegionLevel level, std::uint32_t step, std::uint32_t key) const {
+        switch (level) {
+            case RegionLevel::ACTIVE:
+                return {};
+            case RegionLevel::REDUCED:
+                if ((step + key) % reduced_interval_ == 0) return {true, static_cast<float>(reduced_interval_)};
+                return {false, 1.0f};
+            case RegionLevel::DORMANT:
+                break;
+        }
+        return {false, 1.0f};
+    }
+    /// @brief 包围盒是否完全位于（向外扩展 margin 后的）世界范围之外
+    bool isOutOfWorld(const engine::utils::Rect& aabb, float margin) const;
+
+    const engine::utils::Rect& getWorldRect() const { return world_rect_; }
+    const glm::vec2& getChunkSize() const { return chunk_size_; }
+};
+
+}   // namespace engine::physics
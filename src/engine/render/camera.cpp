@@ -5,7 +5,7 @@
 namespace engine::render {
 
 Camera::Camera(const glm::vec2 &viewport_size, const glm::vec2 &position, const std::optional<engine::utils::Rect> viewport_rect)
-    : viewport_size_(viewport_size), position_(position), limit_bounds_(viewport_rect)
+    : viewport_size_(viewport_size), position_(position), previous_position_(position), render_position_(position), limit_bounds_(viewport_rect)
 {
     spdlog::trace("Camera created, position: {},{}", position.x, position.y);
 }
@@ -14,6 +14,7 @@ void Camera::update(float delta_time)
 {
     if (target_ == nullptr) return;
 
+    previous_position_ = position_;
     glm::vec2 target_pos = target_->getPosition();
     glm::vec2 desired_position = target_pos - viewport_size_ / 2.0f;    // 屏幕中心对齐
 
@@ -34,36 +35,47 @@ void Camera::update(float delta_time)
     }
 
     clampPosition();
+    render_position_ = position_;
 
 }
 
+void Camera::updateRenderPosition(float alpha)
+{
+    render_position_ = glm::mix(previous_position_, position_, alpha);
+    render_position_ = glm::vec2(glm::round(render_position_.x), glm::round(render_position_.y));
+}
+
 void Camera::move(const glm::vec2 &offset)
 {
     position_ += offset;
     clampPosition();
+    previous_position_ = position_;
+    render_position_ = position_;
 }
 
 
 glm::vec2 Camera::worldToScreen(const glm::vec2 &world_pos) const
 {
     // 世界坐标减去相机左上角坐标
-    return world_pos - position_;
+    return world_pos - render_position_;
 }
 
 glm::vec2 Camera::worldToScreenWithParallax(const glm::vec2 &world_pos, const glm::vec2 &scroll_factor) const
 {
-    return world_pos - position_ * scroll_factor;
+    return world_pos - render_position_ * scroll_factor;
 }
 
 glm::vec2 Camera::screenToWorld(const glm::vec2 &screen_pos) const
 {
-    return screen_pos + position_;
+    return screen_pos + render_position_;
 }
 
 void Camera::setPosition(const glm::vec2 &position)
 {
     position_ = position;
     clampPosition();
+    previous_position_ = position_;
+    render_position_ = position_;
 }
 
 void Camera::setLimitBounds(const std::optional<engine::utils::Rect> &limit_bounds)
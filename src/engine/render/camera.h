@@ -13,6 +13,8 @@ class Camera final {
 private:
     glm::vec2 viewport_size_;   // 屏幕大小(视窗大小)
     glm::vec2 position_;        // 相机左上角的世界坐标
+    glm::vec2 previous_position_;   // 上一次 update 前的位置，用于渲染插值
+    glm::vec2 render_position_;     // 渲染时使用的位置（坐标转换基于此位置）
     std::optional<engine::utils::Rect> limit_bounds_;   // 限制相机移动范围，空值表示不限制
     float smooth_speed_ = 5.0f;  // 相机移动平滑速度
     engine::component::TransformComponent* target_ = nullptr;  // 相机跟随的目标
@@ -22,6 +24,7 @@ public:
 
     void update(float delta_time);
     void move(const glm::vec2& offset);
+    void updateRenderPosition(float alpha);     // 渲染前调用，在上一步与当前步的位置之间插值
 
     glm::vec2 worldToScreen(const glm::vec2& world_pos) const; // 将世界坐标转换为屏幕坐标
     glm::vec2 worldToScreenWithParallax(const glm::vec2& world_pos, const glm::vec2& scroll_factor) const; // 将世界坐标转换为屏幕坐标，考虑视差滚动
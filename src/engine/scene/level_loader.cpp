@@ -11,6 +11,7 @@
 #include "../component/audio_component.h"
 #include "../render/animation.h"
 #include "../physics/collider.h"
+#include "../physics/collision_layer.h"
 #include "../scene/scene.h"
 #include "../core/context.h"
 #include "../utils/math.h"
@@ -18,6 +19,7 @@
 #include <spdlog/spdlog.h>
 #include <nlohmann/json.hpp>
 #include <fstream>
+#include <algorithm>
 
 
 namespace engine::scene {
@@ -103,11 +105,10 @@ namespace engine::scene {
 
         // more attributes...
 
-        auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
+        auto* game_object = scene->createGameObject(layer_name);
         game_object->addComponent<engine::component::TransformComponent>(offset);
         game_object->addComponent<engine::component::ParallaxComponent>(texture_id, strcoll_factor, repeat);
 
-        scene->addGameObject(std::move(game_object));
         spdlog::info("Loaded image layer: {}", layer_name);
     }
 
@@ -129,10 +130,9 @@ namespace engine::scene {
         }
 
         const std::string& layer_name = layer_json.value("name", "Unnamed");
-        auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
+        auto* game_object = scene->createGameObject(layer_name);
         game_object->addComponent<engine::component::TileLayerComponent>(tile_size_, map_size_, std::move(tiles));
 
-        scene->addGameObject(std::move(game_object));
         spdlog::info("Loaded tile layer: {}", layer_name);
     }
 
@@ -161,7 +161,7 @@ namespace engine::scene {
                 // 没有这些表示则默认时矩形对象
                 else {
                     const std::string& object_name = object_json.value("name", "Unnamed");
-                    auto game_object = std::make_unique<engine::object::GameObject>(object_name);
+                    auto* game_object = scene->createGameObject(object_name);
                     auto position = glm::vec2(object_json.value("x", 0.0f), object_json.value("y", 0.0f));
                     auto dst_size = glm::vec2(object_json.value("width", 0.0f), object_json.value("height", 0.0f));
                     auto rotation = object_json.value("rotation", 0.0f);
@@ -172,15 +172,16 @@ namespace engine::scene {
                     auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
                         // 自定义形状对象通常是 trigger 类型的，除非显示指定
                     cc->setTrigger(object_json.value("trgger", true));
-                    game_object->addComponent<engine::component::PhysicsComponent>(&scene->getContext().getPhysicsEngine(), false);
+                    auto* pc = game_object->addComponent<engine::component::PhysicsComponent>(&scene->getContext().getPhysicsEngine(), false);
+                    pc->setBodyType(engine::physics::BodyType::STATIC);    // 矩形区域默认不移动
+                    applyBodyType(game_object, object_json);
 
                     // 获取标签信息并设置
                     if (auto tag = getTileProperty<std::string>(object_json, "tag"); tag) {
                         game_object->setTag(tag.value());
                     }
+                    applyCollisionLayer(game_object, object_json);
 
-                    // 添加到场景中
-                    scene->addGameObject(std::move(game_object));
                     spdlog::info("Loaded object: {}", object_name);
                 }
             }
@@ -209,7 +210,7 @@ namespace engine::scene {
 
                 const std::string& object_name = object_json.value("name", "Unnamed");
 
-                auto game_object = std::make_unique<engine::object::GameObject>(object_name);
+                auto* game_object = scene->createGameObject(object_name);
                 game_object->addComponent<engine::component::TransformComponent>(position, scale, rotation);
                 game_object->addComponent<engine::component::SpriteComponent>(std::move(tile_info.sprite),scene->getContext().getResourceManager());
 
@@ -219,12 +220,21 @@ namespace engine::scene {
                 if (tile_info.type == engine::component::TileType::SOLID){  // 图集瓦片碰撞标签
                     auto collider = std::make_unique<engine::physics::AABBCollider>(src_size);
                     game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                    game_object->addComponent<engine::component::PhysicsComponent>(&scene->getContext().getPhysicsEngine(),false);
+                    auto* pc = game_object->addComponent<engine::component::PhysicsComponent>(&scene->getContext().getPhysicsEngine(),false);
+                    pc->setBodyType(engine::physics::BodyType::STATIC);    // 阻挡物默认不移动
                     game_object->setTag("solid");
                 } else if (auto rect = getColliderRect(tile_json); rect){ // 对象瓦片自定义碰撞盒
-                    auto collider = std::make_unique<engine::physics::AABBCollider>(rect->size);
-                    auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                    cc->setOffset(rect->position);  // 自定义碰撞盒的坐标是相对于图片坐标。
+                    if (isCircleCollider(tile_json)) {
+                        // 圆形碰撞器（圆形道具、投射物等）：直径取碰撞矩形的短边，并居中于矩形
+                        auto radius = std::min(rect->size.x, rect->size.y) * 0.5f;
+                        auto collider = std::make_unique<engine::physics::CircleCollider>(radius);
+                        auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
+                        cc->setOffset(rect->position + (rect->size - glm::vec2(radius * 2.0f)) * 0.5f);
+                    } else {
+                        auto collider = std::make_unique<engine::physics::AABBCollider>(rect->size);
+                        auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
+                        cc->setOffset(rect->position);  // 自定义碰撞盒的坐标是相对于图片坐标。
+                    }
                     game_object->addComponent<engine::component::PhysicsComponent>(&scene->getContext().getPhysicsEngine(),false);
                 }
 
@@ -237,6 +247,9 @@ namespace engine::scene {
                 else if (tile_info.type == engine::component::TileType::HAZARD){
                     game_object->setTag("hazard");
                 }
+                if (tile_json) {
+                    applyCollisionLayer(game_object, tile_json.value());
+                }
 
                 // 获取重力信息
                 auto gravity = getTileProperty<bool>(tile_json, "gravity");
@@ -250,6 +263,21 @@ namespace engine::scene {
                     }
                 }
 
+                // 获取刚体类型（"static"、"kinematic"、"dynamic"）
+                if (tile_json) {
+                    applyBodyType(game_object, tile_json.value());
+                }
+
+                // 获取高速物体信息（启用与瓦片层的连续碰撞检测）
+                auto bullet = getTileProperty<bool>(tile_json, "bullet");
+                if (bullet){
+                    if (game_object->hasComponent<engine::component::PhysicsComponent>()) {
+                        game_object->getComponent<engine::component::PhysicsComponent>()->setBullet(bullet.value());
+                    } else {
+                        spdlog::warn("Object {} has bullet property but no physics component", object_name);
+                    }
+                }
+
                 // 获取动画信息并设置
                 auto anim_string = getTileProperty<std::string>(tile_json, "animation");
                 if (anim_string){
@@ -261,6 +289,7 @@ namespace engine::scene {
                     catch(const nlohmann::json::parse_error& e)
                     {
                         spdlog::error("解析动画 JSON 字符串失败：{}", e.what());
+                        scene->removeGameObject(game_object);
                         continue;   // 跳过当前对象
                     }
                     // 添加 AnimationComponent
@@ -279,6 +308,7 @@ namespace engine::scene {
                     catch(const std::exception& e)
                     {
                         spdlog::error("解析音效 JSON 字符串失败：{}", e.what());
+                        scene->removeGameObject(game_object);
                         continue;   // 跳过当前对象
                     }
                     auto* audio_component = game_object->addComponent<engine::component::AudioComponent>(&scene->getContext().getAudioPlayer(),
@@ -292,8 +322,6 @@ namespace engine::scene {
                     game_object->addComponent<engine::component::HealthComponent>(health.value());
                 }
 
-                // 添加到场景中
-                scene->addGameObject(std::move(game_object));
                 spdlog::info("Loaded object: {}", object_name);
             }
         }
@@ -359,6 +387,59 @@ void LevelLoader::addSound(const nlohmann::json & sound_json, engine::component:
     }
 }
 
+    void LevelLoader::applyCollisionLayer(engine::object::GameObject *game_object, const nlohmann::json &properties_json)
+    {
+        auto* cc = game_object->getComponent<engine::component::ColliderComponent>();
+        if (!cc) return;
+
+        // 碰撞层：显式属性 > 标签推断 > 触发器 > 默认
+        auto layer = engine::physics::CollisionLayer::DEFAULT;
+        if (auto layer_name = getTileProperty<std::string>(properties_json, "collision_layer"); layer_name) {
+            if (auto parsed = engine::physics::parseCollisionMask(layer_name.value()); parsed) {
+                layer = parsed.value();
+            } else {
+                spdlog::warn("Object {} has unknown collision_layer '{}', use default", game_object->getName(), layer_name.value());
+            }
+        } else if (auto tag_layer = engine::physics::getCollisionLayerByName(game_object->getTag()); tag_layer) {
+            layer = tag_layer.value();
+        } else if (cc->isTrigger()) {
+            layer = engine::physics::CollisionLayer::TRIGGER;
+        }
+
+        auto mask = engine::physics::getDefaultCollisionMask(layer);
+        if (auto mask_text = getTileProperty<std::string>(properties_json, "collision_mask"); mask_text) {
+            if (auto parsed = engine::physics::parseCollisionMask(mask_text.value()); parsed) {
+                mask = parsed.value();
+            } else {
+                spdlog::warn("Object {} has unknown collision_mask '{}', use default", game_object->getName(), mask_text.value());
+            }
+        }
+
+        cc->setCollisionLayer(layer);
+        cc->setCollisionMask(mask);
+    }
+
+    void LevelLoader::applyBodyType(engine::object::GameObject *game_object, const nlohmann::json &properties_json)
+    {
+        auto type_name = getTileProperty<std::string>(properties_json, "body_type");
+        if (!type_name) return;
+
+        auto* pc = game_object->getComponent<engine::component::PhysicsComponent>();
+        if (!pc) {
+            spdlog::warn("Object {} has body_type property but no physics component", game_object->getName());
+            return;
+        }
+        if (type_name.value() == "static") {
+            pc->setBodyType(engine::physics::BodyType::STATIC);
+        } else if (type_name.value() == "kinematic") {
+            pc->setBodyType(engine::physics::BodyType::KINEMATIC);
+        } else if (type_name.value() == "dynamic") {
+            pc->setBodyType(engine::physics::BodyType::DYNAMIC);
+        } else {
+            spdlog::warn("Object {} has unknown body_type '{}'", game_object->getName(), type_name.value());
+        }
+    }
+
     std::optional<engine::utils::Rect> LevelLoader::getColliderRect(const nlohmann::json &tile_json)
     {
         if (!tile_json.contains("objectgroup")) return std::nullopt;
@@ -374,6 +455,22 @@ void LevelLoader::addSound(const nlohmann::json & sound_json, engine::component:
         return std::nullopt;
     }
 
+    bool LevelLoader::isCircleCollider(const nlohmann::json &tile_json)
+    {
+        if (auto shape = getTileProperty<std::string>(tile_json, "collider_shape"); shape) {
+            return shape.value() == "circle";
+        }
+        if (!tile_json.contains("objectgroup")) return false;
+        auto& objectgroup = tile_json["objectgroup"];
+        if (!objectgroup.contains("objects")) return false;
+        for (const auto& object : objectgroup["objects"]) {    // 与 getColliderRect 一致，取第一个不为空的碰撞形状
+            if (object.value("width", 0.0f) > 0.0f && object.value("height", 0.0f) > 0.0f) {
+                return object.value("ellipse", false);
+            }
+        }
+        return false;
+    }
+
     engine::component::TileType LevelLoader::getTileType(const nlohmann::json &tile_json)
     {
         if (tile_json.contains("properties")) {
@@ -12,6 +12,10 @@ namespace engine::component {
     class AudioComponent;
 }
 
+namespace engine::object {
+    class GameObject;
+}
+
 namespace engine::scene {
 class Scene;
 
@@ -42,6 +46,28 @@ private:
 
     void addSound(const nlohmann::json& sound_json, engine::component::AudioComponent* audio_component);
 
+    /**
+     * @brief 设置对象碰撞器的碰撞层与检测掩码
+     *
+     * 优先读取 "collision_layer"/"collision_mask" 属性（如 "enemy"、"player|solid"），
+     * 未指定层时按标签推断（solid/player/enemy/item/hazard），触发器默认为 trigger 层；
+     * 未指定掩码时使用该层的默认掩码。对象没有碰撞器时不做任何事。
+     *
+     * @param game_object 游戏对象（需已设置标签）
+     * @param properties_json 含有 "properties" 的json数据（对象或瓦片）
+     */
+    void applyCollisionLayer(engine::object::GameObject* game_object, const nlohmann::json& properties_json);
+
+    /**
+     * @brief 根据 "body_type" 属性（"static"、"kinematic"、"dynamic"）设置对象的刚体类型
+     *
+     * 未指定时保持默认：阻挡物与矩形区域为静态，其它为动态（静止后自动休眠）。
+     *
+     * @param game_object 游戏对象（需已添加 PhysicsComponent）
+     * @param properties_json 含有 "properties" 的json数据（对象或瓦片）
+     */
+    void applyBodyType(engine::object::GameObject* game_object, const nlohmann::json& properties_json);
+
     /**
      * @brief 获取瓦片属性
      *
@@ -73,6 +99,13 @@ private:
      */
     std::optional<engine::utils::Rect> getColliderRect(const nlohmann::json& tile_json);
 
+    /**
+     * @brief 瓦片是否使用圆形碰撞器（属性 "collider_shape" 为 "circle"，或碰撞形状为椭圆）
+     *
+     * @param tile_json 瓦片json数据
+     */
+    bool isCircleCollider(const nlohmann::json& tile_json);
+
 
     /**
      * @brief 根据瓦片json对象获取瓦片类型
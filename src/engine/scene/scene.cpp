@@ -2,10 +2,17 @@
 #include "scene_manager.h"
 #include "../core/context.h"
 #include "../object/game_object.h"
+#include "../object/archetype_storage.h"
+#include "../object/game_object_pool.h"
+#include "../object/game_object_index.h"
+#include "../object/update_scheduler.h"
+#include "../component/transform_component.h"
+#include "../component/physics_component.h"
 #include "../physics/physics_engine.h"
 #include "../render/camera.h"
 #include "../ui/ui_manager.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 namespace engine::scene {
 
@@ -14,7 +21,11 @@ Scene::Scene(std::string name, engine::core::Context &context, engine::scene::Sc
       context_(context),
       scene_manager_(scene_manager),
       ui_manager_(std::make_unique<engine::ui::UIManager>()),
-      is_initialized_(false)
+      is_initialized_(false),
+      archetype_storage_(std::make_unique<engine::object::ArchetypeStorage>()),
+      game_object_index_(std::make_unique<engine::object::GameObjectIndex>()),
+      update_scheduler_(std::make_unique<engine::object::UpdateScheduler>()),
+      game_object_pool_(std::make_unique<engine::object::GameObjectPool>())
 {
     spdlog::trace("Scene {} created", scene_name_);
 }
@@ -32,30 +43,43 @@ void Scene::update(float delta_time)
 {
     if (!is_initialized_) return;
 
-    // 先更新物理引擎
+    // 记录本步开始前的位置，渲染时在两步之间插值
+    archetype_storage_->each<engine::component::TransformComponent>(
+        [](engine::object::GameObject&, engine::component::TransformComponent& transform) {
+            transform.storePreviousPosition();
+        });
+
+    // 模拟细节层级：带刚体的对象与其刚体同步，远离相机时降频（按累计时间更新）或冻结（跳过更新）；
+    // 待删除的对象只跳过，统一在本步结束时移除
+    const auto time_scale = [](engine::object::GameObject& game_object) {
+        if (game_object.isNeedRemove()) return 0.0f;
+        if (!game_object.hasComponent<engine::component::PhysicsComponent>()) return 1.0f;
+        const auto* physics = game_object.getComponent<engine::component::PhysicsComponent>();
+        return physics->isDormant() ? 0.0f : physics->getStepScale();
+    };
+    using engine::component::UpdatePhase;
+
+    update_scheduler_->update(UpdatePhase::INPUT, delta_time, context_, time_scale);
+    update_scheduler_->update(UpdatePhase::AI, delta_time, context_, time_scale);
+    update_scheduler_->update(UpdatePhase::PRE_PHYSICS, delta_time, context_, time_scale);
+
+    // 物理引擎（以相机视野作为区块模拟级别的关注区域）
+    auto& camera = context_.getCamera();
+    context_.getPhysicsEngine().setRegionFocus(engine::utils::Rect(camera.getPosition(), camera.getViewportSize()));
     context_.getPhysicsEngine().update(delta_time);
     // 更新相机
-    context_.getCamera().update(delta_time);
+    camera.update(delta_time);
 
-    for (auto it = game_objects_.begin(); it != game_objects_.end();)
-    {
-        if (*it && !(*it)->isNeedRemove())
-        {
-            (*it)->update(delta_time, context_);
-            ++it;
-        }
-        else
-        {
-            if (*it) {
-                (*it)->clean();
-            }
-            it = game_objects_.erase(it);
-        }
-    }
+    update_scheduler_->update(UpdatePhase::PHYSICS, delta_time, context_, time_scale);
+    update_scheduler_->update(UpdatePhase::POST_PHYSICS, delta_time, context_, time_scale);
+    // 动画只推进自身计时并修改所属对象的精灵，各对象互不依赖，在工作线程上并行更新
+    update_scheduler_->updateParallel(UpdatePhase::ANIMATION, delta_time, context_, time_scale, context_.getThreadPool());
+    update_scheduler_->update(UpdatePhase::RENDER_PREP, delta_time, context_, time_scale);
 
     // 更新 UI
     ui_manager_->update(delta_time, context_);
 
+    removePendingRemovals();
     processPendingAdditions();
 }
 
@@ -63,9 +87,9 @@ void Scene::render()
 {
     if (!is_initialized_) return;
 
-    for (auto &game_object : game_objects_)
+    for (auto* game_object : game_objects_)
     {
-            game_object->render(context_);
+        if (!game_object->isNeedRemove()) game_object->render(context_);
     }
 
     ui_manager_->render(context_);
@@ -78,20 +102,10 @@ void Scene::handleInput()
     // 处理 UI 管理器的输入
     if (ui_manager_->handleInput(context_)) return;
 
-    for (auto it = game_objects_.begin(); it != game_objects_.end();)
+    // 待删除的对象在 update 结束时统一移除，这里只跳过
+    for (size_t i = 0; i < game_objects_.size(); ++i)
     {
-        if (*it && !(*it)->isNeedRemove())
-        {
-            (*it)->handleInput(context_);
-            ++it;
-        }
-        else
-        {
-            if (*it) {
-                (*it)->clean();
-            }
-            it = game_objects_.erase(it);
-        }
+        if (!game_objects_[i]->isNeedRemove()) game_objects_[i]->handleInput(context_);
     }
 }
 
@@ -99,38 +113,31 @@ void Scene::clean()
 {
     if (!is_initialized_) return;
 
-    for (auto &game_object : game_objects_)
-    {
-        game_object->clean();
-    }
+    game_object_pool_->clear();
     game_objects_.clear();
+    pending_additions_.clear();
 
     is_initialized_ = false;
     spdlog::trace("Scene {} cleaned", scene_name_);
 }
 
-void engine::scene::Scene::addGameObject(std::unique_ptr<engine::object::GameObject> &&game_object)
+engine::object::GameObject *Scene::createGameObject(const std::string &name, const std::string &tag)
 {
-    if (game_object)
-    {
-        game_objects_.push_back(std::move(game_object));
-    }
-    else
-    {
-        spdlog::warn("Try to add null game object to scene {}", scene_name_);
-    }
+    auto* game_object = game_object_pool_->create(name, tag);
+    archetype_storage_->insert(game_object);
+    game_object_index_->insert(game_object);
+    update_scheduler_->insert(game_object);
+    game_objects_.push_back(game_object);
+    return game_object;
 }
-void Scene::safeAddGameObject(std::unique_ptr<engine::object::GameObject> &&game_object)
+
+engine::object::GameObject *Scene::safeCreateGameObject(const std::string &name, const std::string &tag)
 {
-    if (game_object)
-    {
-        pending_additions_.push_back(std::move(game_object));
-    }
-    else
-    {
-        spdlog::warn("Try to add null game object to scene {}", scene_name_);
-    }
+    auto* game_object = game_object_pool_->create(name, tag);
+    pending_additions_.push_back(game_object);
+    return game_object;
 }
+
 void Scene::removeGameObject(engine::object::GameObject *game_object)
 {
     if (!game_object)
@@ -139,16 +146,20 @@ void Scene::removeGameObject(engine::object::GameObject *game_object)
         return;
     }
 
-    auto it = std::remove_if(game_objects_.begin(), game_objects_.end(),
-        [game_object](const std::unique_ptr<engine::object::GameObject> &obj) {
-            return obj.get() == game_object;
-        });
+    // 尚未加入场景的对象（safeCreateGameObject 创建）
+    if (auto pending = std::find(pending_additions_.begin(), pending_additions_.end(), game_object);
+        pending != pending_additions_.end())
+    {
+        pending_additions_.erase(pending);
+        game_object_pool_->destroy(game_object);
+        return;
+    }
 
-    if (it != game_objects_.end())
+    if (auto it = std::find(game_objects_.begin(), game_objects_.end(), game_object); it != game_objects_.end())
     {
-        (*it)->clean();
-        game_objects_.erase(it, game_objects_.end());
         spdlog::trace("Game object {} removed from scene {}", game_object->getName(), scene_name_);
+        game_objects_.erase(it);
+        game_object_pool_->destroy(game_object);
     }
     else
     {
@@ -163,21 +174,53 @@ void Scene::safeRemoveGameObject(engine::object::GameObject *game_object)
 
 engine::object::GameObject *Scene::findGameObjectByName(const std::string &name) const
 {
-    // 找到第一个符合条件的游戏对象就返回
-    for (const auto &game_object : game_objects_){
-        if (game_object && game_object->getName() == name){
-            return game_object.get();
-        }
-    }
+    return findGameObjectByName(engine::utils::Symbol(name));
+}
+
+engine::object::GameObject *Scene::findGameObjectByName(engine::utils::Symbol name) const
+{
+    return game_object_index_->findByName(name);
+}
 
-    return nullptr;
+std::span<engine::object::GameObject* const> Scene::getGameObjectsWithName(engine::utils::Symbol name) const
+{
+    return game_object_index_->withName(name);
+}
+
+std::span<engine::object::GameObject* const> Scene::getGameObjectsWithTag(engine::utils::Symbol tag) const
+{
+    return game_object_index_->withTag(tag);
+}
+
+engine::object::GameObject *Scene::getGameObject(engine::object::GameObjectHandle handle) const
+{
+    return game_object_pool_->get(handle);
+}
+
+void Scene::removePendingRemovals()
+{
+    // 一次遍历完成压缩：保留的对象依次前移（保持更新/渲染顺序），待删除的对象在此批量销毁
+    std::erase_if(game_objects_, [this](engine::object::GameObject* game_object) {
+        if (!game_object->isNeedRemove()) return false;
+        game_object_pool_->destroy(game_object);
+        return true;
+    });
+    update_scheduler_->compact();
 }
 
 void Scene::processPendingAdditions()
 {
-    for (auto &game_object : pending_additions_)
+    for (auto* game_object : pending_additions_)
     {
-        addGameObject(std::move(game_object));
+        // 加入之前就已被标记删除的对象直接回收
+        if (game_object->isNeedRemove()) {
+            game_object_pool_->destroy(game_object);
+            continue;
+        }
+        archetype_storage_->insert(game_object);
+        game_object_index_->insert(game_object);
+        update_scheduler_->insert(game_object);
+        game_objects_.push_back(game_object);
     }
     pending_additions_.clear();
 }
@@ -2,6 +2,9 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include "../object/game_object_handle.h"
+#include "../utils/symbol.h"
+#include <span>
 
 namespace engine::core {
     class Context;
@@ -18,6 +21,10 @@ namespace engine::input {
 
 namespace engine::object {
     class GameObject;
+    class ArchetypeStorage;
+    class GameObjectIndex;
+    class UpdateScheduler;
+    class GameObjectPool;
 }
 
 namespace engine::ui {
@@ -35,12 +42,16 @@ protected:
     std::unique_ptr<engine::ui::UIManager> ui_manager_;
 
     bool is_initialized_ = false;
-    std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;         // 场景中的游戏对象
-    std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;   // 待添加的游戏对象（延时添加）
+    std::unique_ptr<engine::object::ArchetypeStorage> archetype_storage_;     // 按组件组合分组的游戏对象（须先于对象池声明，后于其销毁）
+    std::unique_ptr<engine::object::GameObjectIndex> game_object_index_;      // 按名称/标签索引的游戏对象（同样须先于对象池声明）
+    std::unique_ptr<engine::object::UpdateScheduler> update_scheduler_;       // 按更新阶段组织的组件列表（同样须先于对象池声明）
+    std::unique_ptr<engine::object::GameObjectPool> game_object_pool_;        // 场景中所有游戏对象的存储（槽位复用）
+    std::vector<engine::object::GameObject*> game_objects_;         // 场景中的游戏对象（更新/渲染顺序）
+    std::vector<engine::object::GameObject*> pending_additions_;   // 待添加的游戏对象（延时添加）
 
 public:
     Scene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager);
-    virtual ~Scene();   // 析构函数，确保子类正确释放资源；放到cpp文件中实现，避免引用 GameObject 的头文件
+    virtual ~Scene();   // 析构函数，确保子类正确释放资源；放到cpp文件中实现，避免引用对象池的头文件
 
     Scene(const Scene&) = delete;
     Scene& operator=(const Scene&) = delete;
@@ -55,14 +66,22 @@ public:
     virtual void clean();
 
 
-    virtual void addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object);      // 使用右值传递避免拷贝
-    virtual void safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object);
-    virtual void removeGameObject(engine::object::GameObject* game_object);
-    virtual void safeRemoveGameObject(engine::object::GameObject* game_object);
+    /// @brief 从对象池创建游戏对象并立即加入场景
+    virtual engine::object::GameObject* createGameObject(const std::string& name = "", const std::string& tag = "");
+    /// @brief 从对象池创建游戏对象，在本次更新结束时加入场景（更新过程中生成对象时使用）
+    virtual engine::object::GameObject* safeCreateGameObject(const std::string& name = "", const std::string& tag = "");
+    virtual void removeGameObject(engine::object::GameObject* game_object);         // 立即移除（线性查找，更新过程中请使用 safeRemoveGameObject）
+    virtual void safeRemoveGameObject(engine::object::GameObject* game_object);     // 标记待删除，本次 update 结束时统一移除
 
 
 
     engine::object::GameObject* findGameObjectByName(const std::string& name) const;
+    engine::object::GameObject* findGameObjectByName(engine::utils::Symbol name) const;
+    /// @brief 场景中名称/标签为指定值的所有对象（索引中已建好的列表，增删对象后失效）
+    std::span<engine::object::GameObject* const> getGameObjectsWithName(engine::utils::Symbol name) const;
+    std::span<engine::object::GameObject* const> getGameObjectsWithTag(engine::utils::Symbol tag) const;
+    /// @brief 句柄对应的游戏对象，对象已被移除时返回 nullptr
+    engine::object::GameObject* getGameObject(engine::object::GameObjectHandle handle) const;
 
     // getters and setters
     void setName(const std::string& name) {scene_name_ = name;}
@@ -72,10 +91,11 @@ public:
 
     engine::core::Context& getContext() {return context_;}
     engine::scene::SceneManager& getSceneManager() {return scene_manager_;}
-    const std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() const {return game_objects_;}
-    std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() {return game_objects_;}
+    const std::vector<engine::object::GameObject*>& getGameObjects() const {return game_objects_;}
+    engine::object::ArchetypeStorage& getArchetypeStorage() {return *archetype_storage_;}
 
 private:
+    void removePendingRemovals();       // 移除并销毁所有标记为待删除的对象（每次 update 结束时一次）
     void processPendingAdditions();
 };
 }   // namespace engine::scene
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "symbol.h"
+#include <deque>
+#include <unordered_map>
+
+namespace engine::utils {
+
+namespace {
+
+    /// @brief 全局字符串表（首次使用时创建，保证在其他全局常量驻留之前初始化）
+    struct SymbolTable {
+        std::deque<std::string> strings{std::string()};                // 编号 -> 字符串（deque 追加时不移动已有元素）
+        std::unordered_map<std::string_view, std::uint32_t> ids{{std::string_view(), 0u}};   // 字符串 -> 编号（视图指向 strings）
+    };
+
+    SymbolTable& table()
+    {
+        static SymbolTable instance;
+        return instance;
+    }
+
+} // namespace
+
+    Symbol::Symbol(std::string_view text)
+    {
+        auto& symbols = table();
+        if (auto it = symbols.ids.find(text); it != symbols.ids.end()) {
+            id_ = it->second;
+            return;
+        }
+        id_ = static_cast<std::uint32_t>(symbols.strings.size());
+        const auto& stored = symbols.strings.emplace_back(text);
+        symbols.ids.emplace(stored, id_);
+    }
+
+    const std::string &Symbol::str() const
+    {
+        return table().strings[id_];
+    }
+
+}   // namespace engine::utils
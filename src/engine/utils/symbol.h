@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace engine::utils {
+
+/**
+ * @brief 驻留字符串（名称、标签等）：全局字符串表中的整数编号
+ *
+ * 相同内容的字符串总是得到同一个编号，比较与散列只需整数运算；空字符串的编号固定为 0。
+ * 表只增不减，字符串的地址保持不变。驻留（构造 Symbol）与 str() 只应在主线程中进行，比较编号可以在任意线程。
+ * 常用的名称/标签可以在命名空间作用域中定义为常量，在程序启动时驻留。
+ */
+class Symbol final {
+private:
+    std::uint32_t id_ = 0;
+
+public:
+    Symbol() = default;
+    explicit Symbol(std::string_view text);
+
+    std::uint32_t id() const { return id_; }
+    bool empty() const { return id_ == 0; }
+    const std::string& str() const;     // 驻留的字符串
+
+    bool operator==(const Symbol&) const = default;
+};
+
+/// @brief 按编号散列，用作 unordered_map 的键
+struct SymbolHash {
+    size_t operator()(Symbol symbol) const { return symbol.id(); }
+};
+
+}   // namespace engine::utils
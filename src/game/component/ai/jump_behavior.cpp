@@ -40,7 +40,7 @@ void JumpBehavior::update(float delta_time, AIComponent &ai_component)
             audio_component->playSound("cry", -1, true);    // 使用空间音频播放声音
         }
         jump_timer_ += delta_time;
-        physics_component->velocity_.x = 0.0f;
+        physics_component->velocity().x = 0.0f;
 
         if (jump_timer_ >= jump_interval_) {
             jump_timer_ = 0.0f;
@@ -52,7 +52,7 @@ void JumpBehavior::update(float delta_time, AIComponent &ai_component)
                 jumping_right_ = true;
             }
             auto jump_vel_x = jumping_right_ ? jump_vel_.x : -jump_vel_.x;
-            physics_component->velocity_ = glm::vec2(jump_vel_x, jump_vel_.y);
+            physics_component->velocity() = glm::vec2(jump_vel_x, jump_vel_.y);
             animation_component->playAnimation("jump");
             sprite_component->setFlipped(jumping_right_);
 
@@ -38,10 +38,10 @@ void PatrolBehavior::update(float, AIComponent &ai_component)
     auto current_x = transform_component->getPosition().x;
 
     if (physics_component->hasCollidedRight() || current_x >= patrol_max_x_) {
-        physics_component->velocity_.x = -move_speed_;
+        physics_component->velocity().x = -move_speed_;
         move_right_ = false;
     } else if (physics_component->hasCollidedLeft() || current_x <= patrol_min_x_) {
-        physics_component->velocity_.x = move_speed_;
+        physics_component->velocity().x = move_speed_;
         move_right_ = true;
     }
 
@@ -42,10 +42,10 @@ void UpDownBehavior::update(float, AIComponent &ai_component)
     auto current_y = transform_component->getPosition().y;
 
     if (physics_component->hasCollidedAbove() || current_y <= patrol_min_y_) {
-        physics_component->velocity_.y = move_speed_;
+        physics_component->velocity().y = move_speed_;
         move_down_ = true;
     } else if (physics_component->hasCollidedBelow() || current_y >= patrol_max_y_) {
-        physics_component->velocity_.y = -move_speed_;
+        physics_component->velocity().y = -move_speed_;
         move_down_ = false;
     }
 
@@ -58,6 +58,8 @@ void AIComponent::init()
 
 void AIComponent::update(float delta_time, engine::core::Context &)
 {
+    // 刚体本步被冻结时不执行行为（行为只修改速度，冻结期间不会生效）；降频时 delta_time 已按间隔放大
+    if (physics_component_ && physics_component_->isDormant()) return;
     if (current_behavior_) {
         current_behavior_->update(delta_time, *this);
     } else {
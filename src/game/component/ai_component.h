@@ -32,6 +32,8 @@ private:
 
 
 public:
+    static constexpr engine::component::ComponentTypeId COMPONENT_TYPE_ID = engine::component::FIRST_GAME_COMPONENT_TYPE_ID + 0;
+
     AIComponent() = default;
     ~AIComponent() override = default;
 
@@ -51,6 +53,8 @@ public:
     engine::component::AnimationComponent* getAnimationComponent() const { return animation_component_;}
     engine::component::AudioComponent* getAudioComponent() const { return audio_component_;}
 
+    engine::component::UpdatePhase getUpdatePhase() const override { return engine::component::UpdatePhase::AI; }   // 在物理模拟之前设置速度
+
 private:
     void init() override;
     void update(float delta_time, engine::core::Context&) override;
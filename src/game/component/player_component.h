@@ -54,6 +54,8 @@ private:
     float flash_timer_ = 0.0f;  // 无敌闪烁计时器
 
 public:
+    static constexpr engine::component::ComponentTypeId COMPONENT_TYPE_ID = engine::component::FIRST_GAME_COMPONENT_TYPE_ID + 1;
+
     PlayerComponent() = default;
     ~PlayerComponent() override = default;
 
@@ -91,6 +93,8 @@ public:
     void setState(std::unique_ptr<state::PlayerState> new_state);  // 切换玩家状态
     bool isOnGround() const;  // 玩家是否在地面上(考虑了 Coyote time)
 
+    engine::component::UpdatePhase getUpdatePhase() const override { return engine::component::UpdatePhase::POST_PHYSICS; }   // 读取本步的碰撞结果并切换状态
+
 private:
 
     void init() override;  // 初始化组件
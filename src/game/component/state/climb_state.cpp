@@ -43,8 +43,8 @@ namespace game::component::state {
         auto is_right = input_manager.isActionDown("move_right");
         auto speed = player_component_->getClimbSpeed();
 
-        physics_component->velocity_.y = is_up ? -speed : is_down ? speed : 0;
-        physics_component->velocity_.x = is_left ? -speed : is_right ? speed : 0;
+        physics_component->velocity().y = is_up ? -speed : is_down ? speed : 0;
+        physics_component->velocity().x = is_left ? -speed : is_right ? speed : 0;
 
         // 根据是否有按键决定动画播放情况
         (is_up || is_down || is_left || is_right) ? aniimation_component->resumeAnimation() : aniimation_component->stopAnimation();
@@ -18,7 +18,7 @@ namespace game::component::state {
         spdlog::debug("玩家进入死亡状态");
         playAnimation("hurt");
         auto physics_component = player_component_->getPhysicsComponent();
-        physics_component->velocity_ = glm::vec2(0.0f, -200.0f);    // 向上击退
+        physics_component->velocity() = glm::vec2(0.0f, -200.0f);    // 向上击退
 
         auto collider_component = player_component_->getOwner()->getComponent<engine::component::ColliderComponent>();
         if (collider_component)
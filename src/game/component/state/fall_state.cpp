@@ -35,14 +35,14 @@ namespace game::component::state{
 
         // 下落状态可以左右移动
         if (input_manager.isActionDown("move_left")){
-            if (physics_component->velocity_.x > 0.0f){
-                physics_component->velocity_.x = 0.0f;      // 先减速到0，增强手感
+            if (physics_component->velocity().x > 0.0f){
+                physics_component->velocity().x = 0.0f;      // 先减速到0，增强手感
             }
             physics_component->addForce({-player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(true); // 向左移动时翻转精灵图
         } else if (input_manager.isActionDown("move_right")){
-            if (physics_component->velocity_.x < 0.0f){
-                physics_component->velocity_.x = 0.0f;
+            if (physics_component->velocity().x < 0.0f){
+                physics_component->velocity().x = 0.0f;
             }
             physics_component->addForce({player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(false); // 向右移动时恢复精灵图
@@ -56,11 +56,11 @@ namespace game::component::state{
         // 限制最大速度（水平方向）
         auto physics_component = player_component_->getPhysicsComponent();
         auto max_speed = player_component_->getMaxSpeed();
-        physics_component->velocity_.x = glm::clamp(physics_component->velocity_.x, -max_speed, max_speed);
+        physics_component->velocity().x = glm::clamp(physics_component->velocity().x, -max_speed, max_speed);
 
         // 如果下方右碰撞，根据水平速度决定切换到 IdleState 或 WalkState
         if (physics_component->hasCollidedBelow()){
-            if (glm::abs(physics_component->velocity_.x) < 1.0f){
+            if (glm::abs(physics_component->velocity().x) < 1.0f){
                 return std::make_unique<IdleState>(player_component_); // 速度小于1时切换到 IdleState
             } else {
                 return std::make_unique<WalkState>(player_component_); // 速度大于1时切换到 WalkState
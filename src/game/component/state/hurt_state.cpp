@@ -22,7 +22,7 @@ namespace game::component::state {
         if (sprite_component->isFlipped()){
             knockback_velocity.x = -knockback_velocity.x;   // 变成向右
         }
-        physics_component->velocity_ = knockback_velocity;
+        physics_component->velocity() = knockback_velocity;
 
         if (auto* audio_component = player_component_->getAudioComponent(); audio_component){
             audio_component->playSound("hurt");
@@ -47,7 +47,7 @@ namespace game::component::state {
         // 1. 落地
         auto physics_component = player_component_->getPhysicsComponent();
         if (physics_component->hasCollidedBelow()) {
-            if (glm::abs(physics_component->velocity_.x < 1.0f)){
+            if (glm::abs(physics_component->velocity().x < 1.0f)){
                 return std::make_unique<IdleState>(player_component_);
             } else {
                 return std::make_unique<WalkState>(player_component_);
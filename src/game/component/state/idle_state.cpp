@@ -53,7 +53,7 @@ namespace game::component::state{
         // 应用摩擦力
         auto physics_component = player_component_->getPhysicsComponent();
         auto friction_factor = player_component_->getFrictionFactor();
-        physics_component->velocity_.x *= friction_factor;
+        physics_component->velocity().x *= friction_factor;
 
         if (!player_component_->isOnGround()){
             return std::make_unique<FallState>(player_component_);
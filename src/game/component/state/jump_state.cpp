@@ -19,8 +19,8 @@ namespace game::component::state{
     {
         playAnimation("jump");
         auto physics_component = player_component_->getPhysicsComponent();
-        physics_component->velocity_.y = - player_component_->getJumpVelocity(); // 向上跳
-        spdlog::debug("JumpState::enter, velocity.y = {}", physics_component->velocity_.y);
+        physics_component->velocity().y = - player_component_->getJumpVelocity(); // 向上跳
+        spdlog::debug("JumpState::enter, velocity.y = {}", physics_component->velocity().y);
 
         if (auto* audio_component = player_component_->getAudioComponent(); audio_component){
             audio_component->playSound("jump");
@@ -44,14 +44,14 @@ namespace game::component::state{
 
         // 跳跃状态可以左右移动
         if (input_manager.isActionDown("move_left")){
-            if (physics_component->velocity_.x > 0.0f){
-                physics_component->velocity_.x = 0.0f;      // 先减速到0，增强手感
+            if (physics_component->velocity().x > 0.0f){
+                physics_component->velocity().x = 0.0f;      // 先减速到0，增强手感
             }
             physics_component->addForce({-player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(true); // 向左移动时翻转精灵图
         } else if (input_manager.isActionDown("move_right")){
-            if (physics_component->velocity_.x < 0.0f){
-                physics_component->velocity_.x = 0.0f;
+            if (physics_component->velocity().x < 0.0f){
+                physics_component->velocity().x = 0.0f;
             }
             physics_component->addForce({player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(false); // 向右移动时恢复精灵图
@@ -65,10 +65,10 @@ namespace game::component::state{
         // 限制最大速度（水平方向）
         auto physics_component = player_component_->getPhysicsComponent();
         auto max_speed = player_component_->getMaxSpeed();
-        physics_component->velocity_.x = glm::clamp(physics_component->velocity_.x, -max_speed, max_speed);
+        physics_component->velocity().x = glm::clamp(physics_component->velocity().x, -max_speed, max_speed);
 
         // 如果速度为正，切换到 FallState
-        if (physics_component->velocity_.y >= 0.0f) {
+        if (physics_component->velocity().y >= 0.0f) {
             return std::make_unique<FallState>(player_component_);
         }
 
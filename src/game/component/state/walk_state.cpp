@@ -39,14 +39,14 @@ namespace game::component::state{
 
         // 步行状态可以左右移动
         if (input_manager.isActionDown("move_left")){
-            if (physics_component->velocity_.x > 0.0f){
-                physics_component->velocity_.x = 0.0f;      // 先减速到0，增强手感
+            if (physics_component->velocity().x > 0.0f){
+                physics_component->velocity().x = 0.0f;      // 先减速到0，增强手感
             }
             physics_component->addForce({-player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(true); // 向左移动时翻转精灵图
         } else if (input_manager.isActionDown("move_right")){
-            if (physics_component->velocity_.x < 0.0f){
-                physics_component->velocity_.x = 0.0f;
+            if (physics_component->velocity().x < 0.0f){
+                physics_component->velocity().x = 0.0f;
             }
             physics_component->addForce({player_component_->getMoveForce(), 0.0f});
             sprite_component->setFlipped(false); // 向右移动时恢复精灵图
@@ -63,7 +63,7 @@ namespace game::component::state{
         // 限制最大速度（水平方向）
         auto physics_conmonent = player_component_->getPhysicsComponent();
         auto max_speed = player_component_->getMaxSpeed();
-        physics_conmonent->velocity_.x = glm::clamp(physics_conmonent->velocity_.x, -max_speed, max_speed);
+        physics_conmonent->velocity().x = glm::clamp(physics_conmonent->velocity().x, -max_speed, max_speed);
 
         // 如果下方没有碰撞，则切换到 FallState
         if (!player_component_->isOnGround()){
@@ -16,6 +16,7 @@
 #include "../../engine/render/text_renderer.h"
 #include "../../engine/physics/physics_engine.h"
 #include "../../engine/utils/math.h"
+#include "../../engine/utils/symbol.h"
 #include "../../engine/audio/audio_player.h"
 #include "../../engine/ui/ui_manager.h"
 #include "../../engine/ui/ui_panel.h"
@@ -34,6 +35,20 @@
 
 namespace game::scene {
 
+namespace {
+    // 场景中用到的对象名称与标签（程序启动时驻留，比较为整数比较）
+    const engine::utils::Symbol PLAYER_NAME{"player"};
+    const engine::utils::Symbol EAGLE_NAME{"eagle"};
+    const engine::utils::Symbol FROG_NAME{"frog"};
+    const engine::utils::Symbol OPOSSUM_NAME{"opossum"};
+    const engine::utils::Symbol FRUIT_NAME{"fruit"};
+    const engine::utils::Symbol GEM_NAME{"gem"};
+    const engine::utils::Symbol ENEMY_TAG{"enemy"};
+    const engine::utils::Symbol ITEM_TAG{"item"};
+    const engine::utils::Symbol HAZARD_TAG{"hazard"};
+    const engine::utils::Symbol NEXT_LEVEL_TAG{"next_level"};
+} // namespace
+
 GameScene::GameScene(engine::core::Context &context, engine::scene::SceneManager &scene_manager, std::shared_ptr<game::data::SessionData> data)
     : Scene("GameScene", context, scene_manager), game_session_data_(std::move(data))
 {
@@ -143,6 +158,9 @@ bool GameScene::initLevel()
     // 设置世界边界
     context_.getPhysicsEngine().setWorldBounds(engine::utils::Rect(glm::vec2(0.0f), world_size));
 
+    // 掉出地图的物体直接删除（玩家除外，见 initPlayer；区块模拟级别由配置开启）
+    context_.getPhysicsEngine().setOutOfWorldPolicy(engine::physics::OutOfWorldPolicy::REMOVE);
+
     spdlog::trace("GameScene has been initialized");
     return true;
 }
@@ -150,7 +168,7 @@ bool GameScene::initLevel()
 bool GameScene::initPlayer()
 {
     // 创建测试对象
-    player_ = findGameObjectByName("player");
+    player_ = findGameObjectByName(PLAYER_NAME);
     if (!player_) {
         spdlog::error("Player not found");
         return false;
@@ -171,6 +189,11 @@ bool GameScene::initPlayer()
     }
     context_.getCamera().setTarget(player_transform);
 
+    // 玩家始终模拟，不受区块模拟级别与离开世界策略的影响
+    if (auto* player_physics = player_->getComponent<engine::component::PhysicsComponent>(); player_physics) {
+        player_physics->setAlwaysActive(true);
+    }
+
     spdlog::trace("Player has been initialized");
     return true;
 }
@@ -178,36 +201,33 @@ bool GameScene::initPlayer()
 bool GameScene::initEnemyAndItem()
 {
     bool success = true;
-    for (auto& game_object : game_objects_){
-        if (game_object->getName() == "eagle")
-        {
-            if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
-                auto y_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().y;
-                auto y_min = y_max - 80.0f;
-                ai_component->setBehavior(std::make_unique<game::component::ai::UpDownBehavior>(y_min, y_max));
-            }
+    for (auto* game_object : getGameObjectsWithName(EAGLE_NAME)){
+        if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
+            auto y_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().y;
+            auto y_min = y_max - 80.0f;
+            ai_component->setBehavior(std::make_unique<game::component::ai::UpDownBehavior>(y_min, y_max));
         }
-        if (game_object->getName() == "frog"){
-            if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
-                auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x - 10.0f;
-                auto x_min = x_max - 90.0f;
-                ai_component->setBehavior(std::make_unique<game::component::ai::JumpBehavior>(x_min, x_max));
-            }
+    }
+    for (auto* game_object : getGameObjectsWithName(FROG_NAME)){
+        if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
+            auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x - 10.0f;
+            auto x_min = x_max - 90.0f;
+            ai_component->setBehavior(std::make_unique<game::component::ai::JumpBehavior>(x_min, x_max));
         }
-        if (game_object->getName() == "opossum"){
-            if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
-                auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x;
-                auto x_min = x_max - 200.0f;
-                ai_component->setBehavior(std::make_unique<game::component::ai::PatrolBehavior>(x_min, x_max));
-            }
+    }
+    for (auto* game_object : getGameObjectsWithName(OPOSSUM_NAME)){
+        if (auto* ai_component = game_object->addComponent<game::component::AIComponent>(); ai_component){
+            auto x_max = game_object->getComponent<engine::component::TransformComponent>()->getPosition().x;
+            auto x_min = x_max - 200.0f;
+            ai_component->setBehavior(std::make_unique<game::component::ai::PatrolBehavior>(x_min, x_max));
         }
-        if (game_object->getTag() == "item"){
-            if (auto* ac = game_object->getComponent<engine::component::AnimationComponent>(); ac){
-                ac->playAnimation("idle");
-            } else {
-                spdlog::error(" Item 对象缺少 AnimationComponent，无法播放动画。");
-                success = false;
-            }
+    }
+    for (auto* game_object : getGameObjectsWithTag(ITEM_TAG)){
+        if (auto* ac = game_object->getComponent<engine::component::AnimationComponent>(); ac){
+            ac->playAnimation("idle");
+        } else {
+            spdlog::error(" Item 对象缺少 AnimationComponent，无法播放动画。");
+            success = false;
         }
     }
 
@@ -227,33 +247,41 @@ bool GameScene::initUI()
 
 void GameScene::handleObjectCollisions()
 {
-    auto collision_pairs = context_.getPhysicsEngine().getCollisionPairs();
-    for (const auto& pair:collision_pairs){
-        auto* obj1 = pair.first;
-        auto* obj2 = pair.second;
+    // 敌人与"hazard"物体在持续接触期间每步都处理（依靠受伤后的无敌时间限制频率，持续接触中的踩踏也能生效）；
+    // 道具与关底触发器只在接触开始时处理一次
+    const auto& contact_events = context_.getPhysicsEngine().getContactEvents();
+    for (const auto& event : contact_events){
+        if (event.phase == engine::physics::ContactPhase::END) continue;
+        auto* obj1 = event.first;
+        auto* obj2 = event.second;
+        const bool is_begin = event.phase == engine::physics::ContactPhase::BEGIN;
+        const auto handles_persist = [](const engine::object::GameObject* obj) {
+            return obj->getTagSymbol() == ENEMY_TAG || obj->getTagSymbol() == HAZARD_TAG;
+        };
+        if (!is_begin && !handles_persist(obj1) && !handles_persist(obj2)) continue;
 
         // 玩家与敌人的碰撞
-        if (obj1->getName() == "player" && obj2->getTag() == "enemy"){
+        if (obj1->getNameSymbol() == PLAYER_NAME && obj2->getTagSymbol() == ENEMY_TAG){
             PlayerVSEnemyCollision(obj1,obj2);
-        } else if (obj1->getTag() == "enemy" && obj2->getName() == "player"){
+        } else if (obj1->getTagSymbol() == ENEMY_TAG && obj2->getNameSymbol() == PLAYER_NAME){
             PlayerVSEnemyCollision(obj2,obj1);
         }
         // 玩家与道具的碰撞
-        else if (obj1->getName() == "player" && obj2->getTag() == "item"){
+        else if (obj1->getNameSymbol() == PLAYER_NAME && obj2->getTagSymbol() == ITEM_TAG){
             PlayerVSItemCollision(obj1,obj2);
-        } else if (obj1->getTag() == "item" && obj2->getName() == "player"){
+        } else if (obj1->getTagSymbol() == ITEM_TAG && obj2->getNameSymbol() == PLAYER_NAME){
             PlayerVSItemCollision(obj2,obj1);
         }
         // 玩家与"hazard"瓦片的碰撞
-        else if (obj1->getName() == "player" && obj2->getTag() == "hazard"){
+        else if (obj1->getNameSymbol() == PLAYER_NAME && obj2->getTagSymbol() == HAZARD_TAG){
             handlePlayerDamage(1);
-        } else if (obj1->getTag() == "hazard" && obj2->getName() == "player"){
+        } else if (obj1->getTagSymbol() == HAZARD_TAG && obj2->getNameSymbol() == PLAYER_NAME){
             handlePlayerDamage(1);
         }
         // 玩家与关底触发器碰撞
-        else if (obj1->getName() == "player" && obj2->getTag() == "next_level"){
+        else if (obj1->getNameSymbol() == PLAYER_NAME && obj2->getTagSymbol() == NEXT_LEVEL_TAG){
             toNextLevel(obj2);
-        } else if (obj1->getTag() == "next_level" && obj2->getName() == "player"){
+        } else if (obj1->getTagSymbol() == NEXT_LEVEL_TAG && obj2->getNameSymbol() == PLAYER_NAME){
             toNextLevel(obj1);
         }
     }
@@ -263,10 +291,11 @@ void GameScene::handleTileTriggers()
 {
     const auto& tile_trigger_events = context_.getPhysicsEngine().getTileTriggerEvents();
     for (const auto& event : tile_trigger_events) {
-        auto* obj = event.first;
-        auto tile_type = event.second;
+        auto* obj = event.object;
+        auto tile_type = event.type;
+        if (event.phase == engine::physics::TileTriggerPhase::EXIT) continue;  // 离开事件无需处理
         if (tile_type == engine::component::TileType::HAZARD){
-            if (obj->getName() == "player"){
+            if (obj->getNameSymbol() == PLAYER_NAME){
                 handlePlayerDamage(1);
                 spdlog::debug("玩家 {} 受到 HAZARD 瓦片伤害", obj->getName());
             }
@@ -316,7 +345,7 @@ void GameScene::PlayerVSEnemyCollision(engine::object::GameObject *player, engin
             createEffect(enemy_center,enemy->getTag());
         }
         // 玩家跳起效果
-        player->getComponent<engine::component::PhysicsComponent>()->velocity_.y = -300.0f;
+        player->getComponent<engine::component::PhysicsComponent>()->velocity().y = -300.0f;
         // 播放音效（此音效可以放在玩家的音频组件中调用）
         context_.getAudioPlayer().playSound("assets/audio/punch2a.mp3");
         // 加分
@@ -332,9 +361,9 @@ void GameScene::PlayerVSEnemyCollision(engine::object::GameObject *player, engin
 
 void GameScene::PlayerVSItemCollision(engine::object::GameObject *player, engine::object::GameObject *item)
 {
-    if (item->getName() == "fruit"){
+    if (item->getNameSymbol() == FRUIT_NAME){
         healWithUI(1);
-    } else if(item->getName() == "gem") {
+    } else if(item->getNameSymbol() == GEM_NAME) {
         addScoreWithUI(5);
     }
     item->setNeedRemove(true);
@@ -355,7 +384,8 @@ void GameScene::toNextLevel(engine::object::GameObject *trigger)
 
 void GameScene::createEffect(const glm::vec2 &center_pos, const std::string &tag)
 {
-    auto effect_obj = std::make_unique<engine::object::GameObject>("effect_" + tag);
+    // 特效在更新过程中生成，本次更新结束时才加入场景；对象与组件都从池中复用
+    auto* effect_obj = safeCreateGameObject("effect_" + tag);
     effect_obj->addComponent<engine::component::TransformComponent>(center_pos);
 
 
@@ -378,6 +408,7 @@ void GameScene::createEffect(const glm::vec2 &center_pos, const std::string &tag
         }
     } else {
         spdlog::warn("未知特效类型：{}",tag);
+        removeGameObject(effect_obj);
         return;
     }
 
@@ -385,7 +416,6 @@ void GameScene::createEffect(const glm::vec2 &center_pos, const std::string &tag
     animation_component->addAnimation(std::move(animation));
     animation_component->setOneShotRemoveal(true);
     animation_component->playAnimation("effect");
-    safeAddGameObject(std::move(effect_obj));
     spdlog::debug("创建特效 {} 完成",tag);
 
 }
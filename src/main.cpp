@@ -1,9 +1,10 @@
 #include "engine/core/game_app.h"
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
+#include <string_view>
 #include <windows.h>
 
-int main(int /* argc */, char** /* argv[] */)
+int main(int argc, char** argv)
 {
     // 避免中文乱码
     SetConsoleOutputCP(CP_UTF8);
@@ -12,6 +13,16 @@ int main(int /* argc */, char** /* argv[] */)
     // Create the game app
     engine::core::GameApp game_app;
 
+    // 命令行参数：--record <文件> 录制输入；--replay <文件> 无界面回放并校验每步的状态散列
+    for (int i = 1; i + 1 < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--record") {
+            game_app.setRecordPath(argv[++i]);
+        } else if (arg == "--replay") {
+            return game_app.runReplay(argv[i + 1]) ? 0 : 1;
+        }
+    }
+
     // Run the game app
     game_app.run();
 